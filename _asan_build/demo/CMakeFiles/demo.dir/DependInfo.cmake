@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_asan_build/demo/CMakeFiles/demo.dir/cmake_pch.hxx.cxx" "demo/CMakeFiles/demo.dir/cmake_pch.hxx.gch" "gcc" "demo/CMakeFiles/demo.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_asan_build/demo/CMakeFiles/demo.dir/cmake_pch.hxx" "demo/CMakeFiles/demo.dir/cmake_pch.hxx.gch" "gcc" "demo/CMakeFiles/demo.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/demo/main.cpp" "demo/CMakeFiles/demo.dir/main.cpp.o" "gcc" "demo/CMakeFiles/demo.dir/main.cpp.o.d"
+  "/root/repo/_asan_build/demo/CMakeFiles/demo.dir/cmake_pch.hxx" "demo/CMakeFiles/demo.dir/main.cpp.o" "gcc" "demo/CMakeFiles/demo.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/demo.dir/cmake_pch.hxx.gch.d"
+  "CMakeFiles/demo.dir/main.cpp.o"
+  "CMakeFiles/demo.dir/main.cpp.o.d"
+  "demo"
+  "demo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx.cxx" "lib/CMakeFiles/curves.dir/cmake_pch.hxx.gch" "gcc" "lib/CMakeFiles/curves.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/cmake_pch.hxx.gch" "gcc" "lib/CMakeFiles/curves.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/lib/src/curves/index/Deduplication.cpp" "lib/CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o.d"
+  "/root/repo/lib/src/curves/index/RadiusBTree.cpp" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o.d"
+  "/root/repo/lib/src/curves/index/RadiusIndex.cpp" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o.d"
+  "/root/repo/lib/src/curves/index/SpatialOrder.cpp" "lib/CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o.d"
+  "/root/repo/lib/src/curves/intersection3d/CircleAxisIndex.cpp" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o.d"
+  "/root/repo/lib/src/curves/intersection3d/CurveDistance.cpp" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o.d"
+  "/root/repo/lib/src/curves/intersection3d/ModelIntersection.cpp" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o.d"
+  "/root/repo/lib/src/curves/intersection3d/PrimitiveIntersection.cpp" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o.d"
+  "/root/repo/lib/src/curves/intersection3d/SceneIntersection.cpp" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/Circle.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/CompactCurveBlock.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/CreationResult.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/Curve.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/CurveFactory.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/CurveProxy.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/CurveStore.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/Ellipse.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/Helix.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/MemoryUsage.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/SharedCurveStore.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/TessellationCache.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o.d"
+  "/root/repo/lib/src/curves/model3d/TubeMesh.cpp" "lib/CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/CurvePipeline.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/CurveRegistry.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/Executor.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/NumaTopology.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/PartitionedCurveStore.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/Reduction.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o.d"
+  "/root/repo/lib/src/curves/parallel/Trace.cpp" "lib/CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o.d"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/cmake_pch.hxx" "lib/CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o" "gcc" "lib/CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curves.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/curves.dir/cmake_pch.hxx.gch.d"
+  "CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/index/Deduplication.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/index/RadiusBTree.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/index/RadiusIndex.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/index/SpatialOrder.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/CircleAxisIndex.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/CurveDistance.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/ModelIntersection.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/PrimitiveIntersection.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/intersection3d/SceneIntersection.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/Circle.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/CompactCurveBlock.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/CreationResult.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/Curve.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveFactory.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveProxy.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/CurveStore.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/Ellipse.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/Helix.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/MemoryUsage.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/SharedCurveStore.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/TessellationCache.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/model3d/TubeMesh.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/CurvePipeline.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/CurveRegistry.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/Executor.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/NumaTopology.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/PartitionedCurveStore.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/Reduction.cpp.o.d"
+  "CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o"
+  "CMakeFiles/curves.dir/src/curves/parallel/Trace.cpp.o.d"
+  "libcurves.pdb"
+  "libcurves.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/curves.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
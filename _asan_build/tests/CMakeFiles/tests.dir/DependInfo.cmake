@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx.cxx" "tests/CMakeFiles/tests.dir/cmake_pch.hxx.gch" "gcc" "tests/CMakeFiles/tests.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/cmake_pch.hxx.gch" "gcc" "tests/CMakeFiles/tests.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/tests/main.cpp" "tests/CMakeFiles/tests.dir/main.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/main.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/main.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/main.cpp.o.d"
+  "/root/repo/tests/test_circle.cpp" "tests/CMakeFiles/tests.dir/test_circle.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_circle.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_circle.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_circle.cpp.o.d"
+  "/root/repo/tests/test_compact_curve_block.cpp" "tests/CMakeFiles/tests.dir/test_compact_curve_block.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_compact_curve_block.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_compact_curve_block.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_compact_curve_block.cpp.o.d"
+  "/root/repo/tests/test_curve_distance.cpp" "tests/CMakeFiles/tests.dir/test_curve_distance.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_distance.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_curve_distance.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_distance.cpp.o.d"
+  "/root/repo/tests/test_curve_factory.cpp" "tests/CMakeFiles/tests.dir/test_curve_factory.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_factory.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_curve_factory.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_factory.cpp.o.d"
+  "/root/repo/tests/test_curve_pipeline.cpp" "tests/CMakeFiles/tests.dir/test_curve_pipeline.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_pipeline.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_curve_pipeline.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_pipeline.cpp.o.d"
+  "/root/repo/tests/test_curve_proxy.cpp" "tests/CMakeFiles/tests.dir/test_curve_proxy.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_proxy.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_curve_proxy.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_proxy.cpp.o.d"
+  "/root/repo/tests/test_curve_registry.cpp" "tests/CMakeFiles/tests.dir/test_curve_registry.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_registry.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_curve_registry.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_curve_registry.cpp.o.d"
+  "/root/repo/tests/test_deduplication.cpp" "tests/CMakeFiles/tests.dir/test_deduplication.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_deduplication.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_deduplication.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_deduplication.cpp.o.d"
+  "/root/repo/tests/test_ellipse.cpp" "tests/CMakeFiles/tests.dir/test_ellipse.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_ellipse.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_ellipse.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_ellipse.cpp.o.d"
+  "/root/repo/tests/test_helix.cpp" "tests/CMakeFiles/tests.dir/test_helix.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_helix.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_helix.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_helix.cpp.o.d"
+  "/root/repo/tests/test_memory_usage.cpp" "tests/CMakeFiles/tests.dir/test_memory_usage.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_memory_usage.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_memory_usage.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_memory_usage.cpp.o.d"
+  "/root/repo/tests/test_model_intersection.cpp" "tests/CMakeFiles/tests.dir/test_model_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_model_intersection.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_model_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_model_intersection.cpp.o.d"
+  "/root/repo/tests/test_partitioned_curve_store.cpp" "tests/CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o.d"
+  "/root/repo/tests/test_primitive_intersection.cpp" "tests/CMakeFiles/tests.dir/test_primitive_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_primitive_intersection.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_primitive_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_primitive_intersection.cpp.o.d"
+  "/root/repo/tests/test_radius_index.cpp" "tests/CMakeFiles/tests.dir/test_radius_index.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_radius_index.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_radius_index.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_radius_index.cpp.o.d"
+  "/root/repo/tests/test_reduction.cpp" "tests/CMakeFiles/tests.dir/test_reduction.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_reduction.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_reduction.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_reduction.cpp.o.d"
+  "/root/repo/tests/test_scene_intersection.cpp" "tests/CMakeFiles/tests.dir/test_scene_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_scene_intersection.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_scene_intersection.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_scene_intersection.cpp.o.d"
+  "/root/repo/tests/test_shared_curve_store.cpp" "tests/CMakeFiles/tests.dir/test_shared_curve_store.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_shared_curve_store.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_shared_curve_store.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_shared_curve_store.cpp.o.d"
+  "/root/repo/tests/test_spatial_order.cpp" "tests/CMakeFiles/tests.dir/test_spatial_order.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_spatial_order.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_spatial_order.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_spatial_order.cpp.o.d"
+  "/root/repo/tests/test_tessellation_cache.cpp" "tests/CMakeFiles/tests.dir/test_tessellation_cache.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_tessellation_cache.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_tessellation_cache.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_tessellation_cache.cpp.o.d"
+  "/root/repo/tests/test_trace.cpp" "tests/CMakeFiles/tests.dir/test_trace.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_trace.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_trace.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_trace.cpp.o.d"
+  "/root/repo/tests/test_tube_mesh.cpp" "tests/CMakeFiles/tests.dir/test_tube_mesh.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_tube_mesh.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_tube_mesh.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_tube_mesh.cpp.o.d"
+  "/root/repo/tests/test_vector_expression.cpp" "tests/CMakeFiles/tests.dir/test_vector_expression.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_vector_expression.cpp.o.d"
+  "/root/repo/_asan_build/tests/CMakeFiles/tests.dir/cmake_pch.hxx" "tests/CMakeFiles/tests.dir/test_vector_expression.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_vector_expression.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/external/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/lib/CMakeFiles/curves.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/external/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
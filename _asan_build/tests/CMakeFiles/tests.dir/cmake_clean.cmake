@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/cmake_pch.hxx.gch"
+  "CMakeFiles/tests.dir/cmake_pch.hxx.gch.d"
+  "CMakeFiles/tests.dir/main.cpp.o"
+  "CMakeFiles/tests.dir/main.cpp.o.d"
+  "CMakeFiles/tests.dir/test_circle.cpp.o"
+  "CMakeFiles/tests.dir/test_circle.cpp.o.d"
+  "CMakeFiles/tests.dir/test_compact_curve_block.cpp.o"
+  "CMakeFiles/tests.dir/test_compact_curve_block.cpp.o.d"
+  "CMakeFiles/tests.dir/test_curve_distance.cpp.o"
+  "CMakeFiles/tests.dir/test_curve_distance.cpp.o.d"
+  "CMakeFiles/tests.dir/test_curve_factory.cpp.o"
+  "CMakeFiles/tests.dir/test_curve_factory.cpp.o.d"
+  "CMakeFiles/tests.dir/test_curve_pipeline.cpp.o"
+  "CMakeFiles/tests.dir/test_curve_pipeline.cpp.o.d"
+  "CMakeFiles/tests.dir/test_curve_proxy.cpp.o"
+  "CMakeFiles/tests.dir/test_curve_proxy.cpp.o.d"
+  "CMakeFiles/tests.dir/test_curve_registry.cpp.o"
+  "CMakeFiles/tests.dir/test_curve_registry.cpp.o.d"
+  "CMakeFiles/tests.dir/test_deduplication.cpp.o"
+  "CMakeFiles/tests.dir/test_deduplication.cpp.o.d"
+  "CMakeFiles/tests.dir/test_ellipse.cpp.o"
+  "CMakeFiles/tests.dir/test_ellipse.cpp.o.d"
+  "CMakeFiles/tests.dir/test_helix.cpp.o"
+  "CMakeFiles/tests.dir/test_helix.cpp.o.d"
+  "CMakeFiles/tests.dir/test_memory_usage.cpp.o"
+  "CMakeFiles/tests.dir/test_memory_usage.cpp.o.d"
+  "CMakeFiles/tests.dir/test_model_intersection.cpp.o"
+  "CMakeFiles/tests.dir/test_model_intersection.cpp.o.d"
+  "CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o"
+  "CMakeFiles/tests.dir/test_partitioned_curve_store.cpp.o.d"
+  "CMakeFiles/tests.dir/test_primitive_intersection.cpp.o"
+  "CMakeFiles/tests.dir/test_primitive_intersection.cpp.o.d"
+  "CMakeFiles/tests.dir/test_radius_index.cpp.o"
+  "CMakeFiles/tests.dir/test_radius_index.cpp.o.d"
+  "CMakeFiles/tests.dir/test_reduction.cpp.o"
+  "CMakeFiles/tests.dir/test_reduction.cpp.o.d"
+  "CMakeFiles/tests.dir/test_scene_intersection.cpp.o"
+  "CMakeFiles/tests.dir/test_scene_intersection.cpp.o.d"
+  "CMakeFiles/tests.dir/test_shared_curve_store.cpp.o"
+  "CMakeFiles/tests.dir/test_shared_curve_store.cpp.o.d"
+  "CMakeFiles/tests.dir/test_spatial_order.cpp.o"
+  "CMakeFiles/tests.dir/test_spatial_order.cpp.o.d"
+  "CMakeFiles/tests.dir/test_tessellation_cache.cpp.o"
+  "CMakeFiles/tests.dir/test_tessellation_cache.cpp.o.d"
+  "CMakeFiles/tests.dir/test_trace.cpp.o"
+  "CMakeFiles/tests.dir/test_trace.cpp.o.d"
+  "CMakeFiles/tests.dir/test_tube_mesh.cpp.o"
+  "CMakeFiles/tests.dir/test_tube_mesh.cpp.o.d"
+  "CMakeFiles/tests.dir/test_vector_expression.cpp.o"
+  "CMakeFiles/tests.dir/test_vector_expression.cpp.o.d"
+  "tests"
+  "tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
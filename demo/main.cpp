@@ -5,10 +5,15 @@
 #include "curves/model3d/Curve.h"
 #include "curves/model3d/CurveFactory.h"
 
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/Reduction.h"
+#include "curves/parallel/Trace.h"
+
 #include <algorithm>
+#include <cstdlib>
 #include <iterator>
 #include <memory>
-#include <thread>
+#include <span>
 #include <vector>
 
 using namespace curves;
@@ -19,6 +24,7 @@ using Point3d = Point<double, 3>;
 using Vector3d = Vector<double, 3>;
 
 std::vector<std::shared_ptr<Curve>> get_random_curves(std::size_t amount) {
+    parallel::TraceSpan span{"demo::generation"};
     std::vector<std::shared_ptr<Curve>> result;
     result.reserve(amount);
 
@@ -28,6 +34,7 @@ std::vector<std::shared_ptr<Curve>> get_random_curves(std::size_t amount) {
 }
 
 std::vector<std::shared_ptr<Circle>> filter_circles(const std::vector<std::shared_ptr<Curve>>& curves) {
+    parallel::TraceSpan span{"demo::filtering"};
     std::vector<std::shared_ptr<Circle>> result{};
 
     for (const auto& curve : curves) {
@@ -65,55 +72,31 @@ void sort_circles_by_radius_safe(std::vector<std::shared_ptr<Circle>>& circles)
 }
 
 void sort_circles_by_radius(std::vector<std::shared_ptr<Circle>>& circles) {
+    parallel::TraceSpan span{"demo::sorting"};
     std::ranges::sort(circles, [](const std::shared_ptr<Circle>& first, const std::shared_ptr<Circle>& second) {
         return first->get_radius() < second->get_radius();
     });
 }
 
 double sum_radii_calculation(const std::vector<std::shared_ptr<Circle>>& circles) {
-    constexpr std::size_t min_elements_per_thread{10};
-
-    if (circles.empty()) {
-        return 0.0;
-    }
-
-    const std::size_t required_number_of_threads{static_cast<std::size_t>(
-        std::ceil(static_cast<double>(circles.size()) / static_cast<double>(min_elements_per_thread)))};
-
-    const std::size_t number_of_threads{
-        std::min(static_cast<std::size_t>(std::thread::hardware_concurrency()), required_number_of_threads)};
-
-    std::vector<double> partial_sums(number_of_threads, 0.0);
-    std::vector<std::thread> threads{};
-    threads.reserve(number_of_threads);
-
-    auto worker = [&](std::size_t partial_index) {
-        std::size_t start{partial_index * min_elements_per_thread};
-        std::size_t end{std::min((partial_index + 1) * min_elements_per_thread, circles.size())}; // circles.size() > 0
-        double sum{std::accumulate(
-            circles.begin() + start, circles.begin() + end, 0.0, [](double sum, const std::shared_ptr<Circle>& circle) {
-                if (!circle) {
-                    return sum;
-                }
-                return sum + circle->get_radius();
-            })};
-        partial_sums[partial_index] = sum;
-    };
-
-    for (std::size_t i{}; i < number_of_threads; ++i) {
-        threads.emplace_back(worker, i);
-    };
-
-    for (auto& thread : threads) {
-        thread.join();
-    }
-
-    return std::accumulate(partial_sums.begin(), partial_sums.end(), 0.0);
+    parallel::TraceSpan span{"demo::summation"};
+    // Compensated fixed-tree summation: every circle is counted and the result does not depend on the core count
+    parallel::Executor executor{};
+    return parallel::sum(
+        std::span<const std::shared_ptr<Circle>>{circles},
+        [](const std::shared_ptr<Circle>& circle) { return circle ? circle->get_radius() : 0.0; },
+        &executor);
 }
 
 int main() {
     constexpr std::size_t amount_of_curves{2000};
 
+    // CURVES_TRACE=<file> records the run as a Chrome trace (chrome://tracing, ui.perfetto.dev)
+    const char* trace_path{std::getenv("CURVES_TRACE")};
+    if (trace_path) {
+        parallel::Tracer::get().enable();
+    }
+
     // - Randomized container: Populate a container with randomly generated curves (random type and parameters).
     const auto& randomized_container{get_random_curves(amount_of_curves)};
 
@@ -128,5 +111,9 @@ int main() {
     // - Make radius summation parallel across threads.
     const auto& sum_radii{sum_radii_calculation(only_circles)};
 
+    if (trace_path) {
+        parallel::Tracer::get().write_chrome_trace(trace_path);
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef __Deduplication_h__
+#define __Deduplication_h__
+
+#include "curves/math/Constants.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+} // namespace model3d
+
+namespace parallel {
+class Executor;
+} // namespace parallel
+
+namespace index {
+
+// Whether the curves describe the same point set within the precision, whatever their parameterization: the sign
+// of the axis and the start direction (phase) do not matter. Centers are compared coordinate-wise (as math::equal),
+// helices by the distance of the start point of the second to the first, so a helix shifted along its axis by a
+// multiple of the step is the same helix.
+bool are_equivalent(const model3d::Curve& first, const model3d::Curve& second, double precision = math::precision);
+
+struct DeduplicationResult {
+    std::vector<std::shared_ptr<model3d::Curve>> curves; // Unique curves, shared with the input, in input order
+    std::vector<std::uint32_t> source; // Input index of every unique curve
+    std::vector<std::uint32_t> remap; // Position in curves of the curve standing for every input curve
+};
+
+// Keeps the first curve of every group of equivalent curves. A curve is dropped when an earlier kept curve is
+// equivalent to it, the same result as a sequential scan. Candidates are found through a hash of the type, the
+// quantized canonical position (center, or the foot of the helix axis), the largest radius and the axis with a
+// normalized sign, probing the neighbouring cells, so the pass runs in near-linear time; hashing and comparisons
+// run on the executor. The foot of a helix axis moves with the tilt of the axis, its cells grow with the distance
+// of the helices from the origin.
+DeduplicationResult deduplicate(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    double precision = math::precision,
+    parallel::Executor* executor = nullptr);
+
+} // namespace index
+} // namespace curves
+
+#endif // __Deduplication_h__
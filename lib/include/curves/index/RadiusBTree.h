@@ -0,0 +1,54 @@
+#ifndef __RadiusBTree_h__
+#define __RadiusBTree_h__
+
+#include "curves/index/RadiusIndex.h"
+
+namespace curves {
+namespace index {
+
+// Dynamic radius index: a B+ tree over (radius, id) whose inner nodes keep the item count of every child,
+// so that rank is O(log n) as well. Leaves are linked both ways for range and nearest scans.
+// A node that drops below a quarter of its capacity is merged into a neighbour when they fit in one node.
+class RadiusBTree {
+public:
+    static constexpr std::size_t node_capacity{64};
+
+    RadiusBTree();
+    ~RadiusBTree();
+    RadiusBTree(RadiusBTree&& other) noexcept;
+    RadiusBTree& operator=(RadiusBTree&& other) noexcept;
+
+    // Bottom-up build from all radii at once, ids are the positions in radii
+    static RadiusBTree build(std::span<const double> radii, parallel::Executor* executor = nullptr);
+
+    void insert(const RadiusItem& item);
+    // false if the item is not in the tree
+    bool erase(const RadiusItem& item);
+
+    std::size_t size() const;
+
+    // Same queries as RadiusIndex
+    std::size_t rank(double radius) const;
+    std::vector<RadiusItem> range(double min, double max) const;
+    std::vector<RadiusItem> nearest(double radius, std::size_t k) const;
+
+    friend model3d::MemoryUsage model3d::memory_usage(const RadiusBTree& tree);
+
+private:
+    struct Node;
+
+    struct Position {
+        const Node* leaf;
+        std::size_t index;
+    };
+
+    // First position holding an item not less than the key
+    Position lower_bound(const RadiusItem& key) const;
+
+    std::unique_ptr<Node> _root;
+};
+
+} // namespace index
+} // namespace curves
+
+#endif // __RadiusBTree_h__
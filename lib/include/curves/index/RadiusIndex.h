@@ -0,0 +1,79 @@
+#ifndef __RadiusIndex_h__
+#define __RadiusIndex_h__
+
+#include "curves/model3d/MemoryUsage.h"
+
+namespace curves {
+
+namespace model3d {
+class Circle;
+} // namespace model3d
+
+namespace parallel {
+class Executor;
+} // namespace parallel
+
+namespace index {
+
+// Radius of an indexed item and its id (position in the input of a bulk build, or the caller's id)
+struct RadiusItem {
+    double radius;
+    std::uint32_t id;
+
+    auto operator<=>(const RadiusItem& other) const = default;
+};
+
+// Items sorted by (radius, id). With an executor the chunks are sorted and merged on its workers.
+std::vector<RadiusItem> get_sorted_items(std::span<const double> radii, parallel::Executor* executor = nullptr);
+std::vector<double> get_radii(std::span<const std::shared_ptr<model3d::Circle>> circles);
+
+// Static radius index: the sorted items plus a copy of the radii in Eytzinger (BFS) order, so that the binary
+// search walks a cache-friendly implicit tree. range, rank and nearest are O(log n) (+ k for the output).
+// For a changing set see RadiusBTree.
+class RadiusIndex {
+public:
+    RadiusIndex() = default;
+
+    static RadiusIndex build(std::span<const double> radii, parallel::Executor* executor = nullptr);
+
+    std::size_t size() const { return _items.size(); };
+    std::span<const RadiusItem> get_items() const { return _items; }; // Ascending
+
+    // Number of items with a radius below the given one
+    std::size_t rank(double radius) const;
+    // Items with min <= radius <= max, ascending
+    std::span<const RadiusItem> range(double min, double max) const;
+    // k items with the radius closest to the given one, closest first (ties: smaller radius first)
+    std::vector<RadiusItem> nearest(double radius, std::size_t k) const;
+
+    friend model3d::MemoryUsage model3d::memory_usage(const RadiusIndex& index);
+
+private:
+    std::vector<RadiusItem> _items;
+    std::vector<double> _eytzinger; // 1-based: children of node i are 2i and 2i + 1
+    std::vector<std::uint32_t> _eytzinger_rank; // Position of node i in _items
+};
+
+// k-nearest selection shared by the indexes: merges the runs going down and up from the position where
+// the radius would be inserted. get_left() and get_right() return the next item in their direction or nullopt.
+template <typename Left, typename Right>
+std::vector<RadiusItem> merge_nearest(double radius, std::size_t k, Left&& get_left, Right&& get_right) {
+    std::vector<RadiusItem> result;
+    auto left{get_left()};
+    auto right{get_right()};
+    while (result.size() < k && (left || right)) {
+        if (!right || (left && radius - left->radius <= right->radius - radius)) {
+            result.push_back(*left);
+            left = get_left();
+        } else {
+            result.push_back(*right);
+            right = get_right();
+        }
+    }
+    return result;
+}
+
+} // namespace index
+} // namespace curves
+
+#endif // __RadiusIndex_h__
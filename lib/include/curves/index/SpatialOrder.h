@@ -0,0 +1,59 @@
+#ifndef __SpatialOrder_h__
+#define __SpatialOrder_h__
+
+#include "curves/math/Point.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+class CurveStore;
+} // namespace model3d
+
+namespace parallel {
+class Executor;
+} // namespace parallel
+
+namespace index {
+
+using Point3d = math::Point<double, 3>;
+
+// Space-filling curve used to order curves by the position of their centers. Hilbert keys keep every step between
+// neighbouring cells, Morton keys are cheaper to compute but jump between octants.
+enum class Spatial_key { morton, hilbert };
+
+inline constexpr std::uint32_t spatial_key_bits{21}; // Per axis, 63 bits per key
+
+// Keys of a cell of the 2^21 grid, x, y and z below 2^21
+std::uint64_t get_morton_key(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+std::uint64_t get_hilbert_key(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+// Center of a circle, ellipse or helix (the point the helix winds around at t = 0)
+Point3d get_center(const model3d::Curve& curve);
+
+// Keys of the curve centers on the grid spanning their bounding box
+std::vector<std::uint64_t> get_spatial_keys(std::span<const Point3d> centers,
+    Spatial_key key = Spatial_key::hilbert,
+    parallel::Executor* executor = nullptr);
+
+// Stable spatial order: order[i] is the index of the curve placed at i, curves with the same key keep their
+// relative order. Keys and sort run on the executor if given.
+std::vector<std::uint32_t> get_spatial_order(std::span<const Point3d> centers,
+    Spatial_key key = Spatial_key::hilbert,
+    parallel::Executor* executor = nullptr);
+std::vector<std::uint32_t> get_spatial_order(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    Spatial_key key = Spatial_key::hilbert,
+    parallel::Executor* executor = nullptr);
+
+// Reorder the curves by get_spatial_order and return the order. The shared curves are only moved between slots.
+// The store is immutable, so it is replaced by a reordered copy (see CurveStore::reordered).
+std::vector<std::uint32_t> reorder_spatially(std::vector<std::shared_ptr<model3d::Curve>>& curves,
+    Spatial_key key = Spatial_key::hilbert,
+    parallel::Executor* executor = nullptr);
+std::vector<std::uint32_t> reorder_spatially(
+    model3d::CurveStore& store, Spatial_key key = Spatial_key::hilbert, parallel::Executor* executor = nullptr);
+
+} // namespace index
+} // namespace curves
+
+#endif // __SpatialOrder_h__
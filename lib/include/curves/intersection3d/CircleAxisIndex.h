@@ -0,0 +1,64 @@
+#ifndef __CircleAxisIndex_h__
+#define __CircleAxisIndex_h__
+
+#include "curves/intersection3d/ModelIntersection.h"
+#include "curves/math/Constants.h"
+#include "curves/model3d/MemoryUsage.h"
+
+namespace curves {
+
+namespace model3d {
+class Circle;
+class Helix;
+} // namespace model3d
+
+namespace intersection3d {
+
+// Circles hashed by the quantized direction of their axis. The cells are larger than the precision, so every
+// circle whose axis is parallel to a query axis (up to the precision) is found in the 3x3x3 cells around the axis
+// or around its opposite. Circles in the other cells are known to be non-parallel without any vector arithmetic.
+class CircleAxisIndex {
+public:
+    explicit CircleAxisIndex(
+        std::span<const std::shared_ptr<model3d::Circle>> circles, double precision = math::precision);
+
+    std::size_t size() const { return _circles.size(); };
+    double get_precision() const { return _precision; };
+    const std::shared_ptr<model3d::Circle>& operator[](std::size_t index) const { return _circles[index]; };
+
+    // Cells that may hold circles parallel to the axis: sorted, without duplicates
+    std::vector<std::uint64_t> get_parallel_cells(const Vector3d& axis) const;
+
+    // Indices of the circles in the cells, ascending within a cell
+    std::span<const std::uint32_t> get_cell(std::uint64_t cell) const;
+    const std::unordered_map<std::uint64_t, std::vector<std::uint32_t>>& get_cells() const { return _cells; };
+
+    friend model3d::MemoryUsage model3d::memory_usage(const CircleAxisIndex& index);
+
+private:
+    std::uint64_t get_cell_key(std::int64_t x, std::int64_t y, std::int64_t z) const;
+
+    std::vector<std::shared_ptr<model3d::Circle>> _circles;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> _cells;
+    double _precision;
+    double _cell_size;
+};
+
+struct CircleIntersection {
+    std::size_t circle_index; // Index of the circle in the CircleAxisIndex
+    IntersectionHit hit; // t_a is the helix parameter, t_b the circle parameter
+};
+
+// Intersections of one helix with all indexed circles, sorted by circle index. Only the circles with a parallel axis
+// are tested (analytically), so a query costs O(k) in the parallel circles instead of O(N). The other circles are
+// skipped because the general solver (get_intersection_hits_non_parallel) does not find hits yet; they have to be
+// visited here once it does.
+// Appends to out and returns the number of hits.
+std::size_t get_intersection(
+    const model3d::Helix& helix, const CircleAxisIndex& circles, std::vector<CircleIntersection>& out);
+std::vector<CircleIntersection> get_intersection(const model3d::Helix& helix, const CircleAxisIndex& circles);
+
+} // namespace intersection3d
+} // namespace curves
+
+#endif // __CircleAxisIndex_h__
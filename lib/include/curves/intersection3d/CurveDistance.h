@@ -0,0 +1,45 @@
+#ifndef __CurveDistance_h__
+#define __CurveDistance_h__
+
+#include "curves/intersection3d/PrimitiveIntersection.h"
+#include "curves/math/Constants.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+} // namespace model3d
+
+namespace intersection3d {
+
+// Closest approach of two curves: distance between P_first(t_a) and P_second(t_b)
+struct CurveDistance {
+    double t_a;
+    double t_b;
+    double distance;
+};
+
+// Minimum distance between the curves, at most tolerance above the exact one. Circle and ellipse parameters are
+// searched over [0, 2pi), helices over helix_range. An unbounded helix range is reduced to the turns that can come
+// closest to the other curve; if both curves are unbounded helices, the first one is reduced to its first turn.
+// Coaxial circle/circle and helix/circle pairs are solved in closed form. The general case is a branch-and-bound
+// over pairs of parameter intervals: each piece is bounded by its tangent segment and the chord deviation
+// get_max_acceleration() * w^2 / 2, so pieces that cannot beat the best distance found so far are pruned.
+CurveDistance get_min_distance(const model3d::Curve& first,
+    const model3d::Curve& second,
+    double tolerance = math::precision,
+    const ParameterRange& helix_range = {});
+
+// Whether the curves come closer than distance. The search stops as soon as a closer pair of points is found or all
+// remaining pieces are proven to be farther, so clear cases cost a few bound evaluations. A minimum within tolerance
+// below distance may be reported either way.
+bool is_closer_than(const model3d::Curve& first,
+    const model3d::Curve& second,
+    double distance,
+    double tolerance = math::precision,
+    const ParameterRange& helix_range = {});
+
+} // namespace intersection3d
+} // namespace curves
+
+#endif // __CurveDistance_h__
@@ -2,16 +2,11 @@
 #define __ModelIntersection_h__
 
 #include "curves/math/Constants.h"
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
 
 namespace curves {
 
-namespace math {
-template <typename T, std::size_t Dim>
-    requires std::is_arithmetic_v<T>
-class Point;
-
-} // namespace math
-
 namespace model3d {
 class Helix;
 class Circle;
@@ -20,11 +15,50 @@ class Circle;
 namespace intersection3d {
 
 using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+enum class Intersection_kind {
+    transversal, // The curves cross each other
+    tangent, // The curves touch each other, tangents are parallel
+    overlap // The curves share a segment, t_a and t_b describe one of its points
+};
+
+struct IntersectionHit {
+    double t_a; // Parameter on the first curve of the query
+    double t_b; // Parameter on the second curve of the query
+    Point3d point;
+    Intersection_kind kind;
+};
+
+// Kind of the contact of two curves with the given tangents at the common point
+Intersection_kind get_intersection_kind(const Vector3d& first_tangent, const Vector3d& second_tangent);
 
 std::vector<Point3d> get_intersection(const model3d::Helix& helix, const model3d::Circle& circle, double precision = math::precision);
 std::vector<Point3d> get_intersection(const model3d::Circle& circle, const model3d::Helix& helix, double precision = math::precision);
 
+std::vector<IntersectionHit> get_intersection_hits(
+    const model3d::Helix& helix, const model3d::Circle& circle, double precision = math::precision);
+std::vector<IntersectionHit> get_intersection_hits(
+    const model3d::Circle& circle, const model3d::Helix& helix, double precision = math::precision);
+
+// Appends the hits to out and returns their number. out is not cleared, so repeated queries can reuse its storage.
+std::size_t get_intersection_hits(const model3d::Helix& helix,
+    const model3d::Circle& circle,
+    std::vector<IntersectionHit>& out,
+    double precision = math::precision);
+std::size_t get_intersection_hits(const model3d::Circle& circle,
+    const model3d::Helix& helix,
+    std::vector<IntersectionHit>& out,
+    double precision = math::precision);
+
+// General solver used by get_intersection_hits when the axes are not parallel. Not implemented yet, it finds no
+// hits; CircleAxisIndex relies on that and does not visit the non-parallel circles.
+std::size_t get_intersection_hits_non_parallel(const model3d::Helix& helix,
+    const model3d::Circle& circle,
+    std::vector<IntersectionHit>& out,
+    double precision = math::precision);
+
 } // namespace intersection3d
 } // namespace curves
 
-#endif // __ModelIntersection_h__
\ No newline at end of file
+#endif // __ModelIntersection_h__
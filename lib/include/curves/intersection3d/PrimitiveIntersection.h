@@ -0,0 +1,113 @@
+#ifndef __PrimitiveIntersection_h__
+#define __PrimitiveIntersection_h__
+
+#include "curves/intersection3d/ModelIntersection.h"
+#include "curves/math/Constants.h"
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+} // namespace model3d
+
+namespace intersection3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+struct Plane {
+    Point3d point;
+    Vector3d normal; // Does not have to be normalized
+};
+
+struct Line {
+    Point3d origin;
+    Vector3d direction; // Does not have to be normalized
+};
+
+// Half-line: origin + s * direction, s >= 0
+struct Ray {
+    Point3d origin;
+    Vector3d direction; // Does not have to be normalized
+};
+
+struct Sphere {
+    Point3d center;
+    double radius;
+};
+
+// Parameter interval searched on a helix. The helix is not closed, so a primitive can cut it infinitely many times
+// (a plane or a line parallel to the axis). In that case an unbounded range is reduced to the first turn [0, 2pi).
+struct ParameterRange {
+    double min{-std::numeric_limits<double>::infinity()};
+    double max{std::numeric_limits<double>::infinity()};
+};
+
+// Hit of a curve with a primitive. For Intersection_kind::overlap (e.g. a circle lying in the plane) t describes
+// one point of the shared part. Circle and ellipse parameters are in [0, 2pi).
+struct PrimitiveHit {
+    double t;
+    Point3d point;
+    Intersection_kind kind;
+};
+
+// Circle and ellipse are solved in closed form, helix by bracketed root finding limited to the turns
+// that can reach the primitive. Hits are appended to out sorted by t, the number of hits is returned.
+std::size_t intersect(const model3d::Curve& curve,
+    const Plane& plane,
+    std::vector<PrimitiveHit>& out,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::size_t intersect(const model3d::Curve& curve,
+    const Line& line,
+    std::vector<PrimitiveHit>& out,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::size_t intersect(const model3d::Curve& curve,
+    const Ray& ray,
+    std::vector<PrimitiveHit>& out,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::size_t intersect(const model3d::Curve& curve,
+    const Sphere& sphere,
+    std::vector<PrimitiveHit>& out,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+
+std::vector<PrimitiveHit> intersect(const model3d::Curve& curve,
+    const Plane& plane,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::vector<PrimitiveHit> intersect(const model3d::Curve& curve,
+    const Line& line,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::vector<PrimitiveHit> intersect(const model3d::Curve& curve,
+    const Ray& ray,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+std::vector<PrimitiveHit> intersect(const model3d::Curve& curve,
+    const Sphere& sphere,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+
+struct SliceHit {
+    std::size_t curve_index;
+    std::size_t plane_index;
+    PrimitiveHit hit;
+};
+
+// Slices every curve by the parallel planes { X : normal * X = offsets[j] } in one pass: the per-curve part of
+// the plane equation is computed once and reused for all planes. The result is sorted by (curve, plane, t).
+std::vector<SliceHit> slice(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    const Vector3d& normal,
+    std::span<const double> offsets,
+    double precision = math::precision,
+    const ParameterRange& helix_range = {});
+
+} // namespace intersection3d
+} // namespace curves
+
+#endif // __PrimitiveIntersection_h__
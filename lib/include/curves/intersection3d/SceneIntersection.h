@@ -0,0 +1,41 @@
+#ifndef __SceneIntersection_h__
+#define __SceneIntersection_h__
+
+#include "curves/intersection3d/ModelIntersection.h"
+#include "curves/math/Constants.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+} // namespace model3d
+
+namespace parallel {
+class Executor;
+class JobControl;
+} // namespace parallel
+
+namespace intersection3d {
+
+// Intersection of the curves with indices first_index < second_index in the input range.
+// hit.t_a is the parameter on the curve first_index, hit.t_b on the curve second_index.
+struct CurvePairIntersection {
+    std::size_t first_index;
+    std::size_t second_index;
+    IntersectionHit hit;
+};
+
+// Finds the intersections of every pair of curves in the range.
+// The circles are put in a tree of bounding spheres and every helix queries it with its cylinder, so only the circles
+// near the helix are visited; the remaining pairs are tested by get_intersection on the executor.
+// The result is sorted by (first_index, second_index) and then by hit.t_a, so it does not depend on the
+// number of threads. If the job is cancelled through control, the intersections found so far are returned.
+std::vector<CurvePairIntersection> find_all_intersections(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    double precision,
+    parallel::Executor& executor,
+    parallel::JobControl* control = nullptr);
+
+} // namespace intersection3d
+} // namespace curves
+
+#endif // __SceneIntersection_h__
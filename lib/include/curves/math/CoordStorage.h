@@ -4,8 +4,24 @@
 namespace curves {
 namespace math {
 
+// Padding after the coordinates. 3D doubles are padded to four lanes (32 bytes) and aligned to 32 bytes, so a point
+// never straddles a cache line and element-wise loops load whole vector registers. The padding lane stays zero.
 template <typename T, std::size_t Dim>
-class CoordStorage {
+struct CoordPadding {};
+
+template <>
+struct CoordPadding<double, 3> {
+    double lane{};
+};
+
+template <typename T, std::size_t Dim>
+inline constexpr std::size_t coord_alignment{alignof(std::array<T, Dim>)};
+
+template <>
+inline constexpr std::size_t coord_alignment<double, 3>{32};
+
+template <typename T, std::size_t Dim>
+class alignas(coord_alignment<T, Dim>) CoordStorage {
 public:
     CoordStorage() = default;
     explicit CoordStorage(T x, T y, T z)
@@ -39,6 +55,7 @@ public:
 
 protected:
     std::array<T, Dim> _data;
+    [[no_unique_address]] CoordPadding<T, Dim> _padding{};
 };
 
 template <typename T, std::size_t Dim>
@@ -0,0 +1,56 @@
+#ifndef __SinCosSequence_h__
+#define __SinCosSequence_h__
+
+namespace curves {
+namespace math {
+
+// Number of recurrence steps between two exact evaluations of cos/sin
+constexpr std::size_t sincos_resync_interval{64};
+
+// Upper bound of |cos(t) - cos_i| and |sin(t) - sin_i| for the values produced by SinCosSequence:
+// each rotation step adds at most about 4 ulp, and the sequence is re-anchored every sincos_resync_interval steps.
+// Multiplied by a radius of up to 1e8 this stays below math::precision.
+constexpr double sincos_sequence_error{4.0 * static_cast<double>(sincos_resync_interval) * 2.220446049250313e-16};
+
+// cos(t0 + i * dt) and sin(t0 + i * dt) for i = 0, 1, 2, ... by the rotation recurrence
+//   cos[i + 1] = cos[i] * cos(dt) - sin[i] * sin(dt)
+//   sin[i + 1] = sin[i] * cos(dt) + cos[i] * sin(dt)
+// which costs four multiply-adds per step instead of two trigonometric calls.
+class SinCosSequence {
+public:
+    SinCosSequence(double t0, double dt)
+        : _t0{t0}, _dt{dt}, _cos{std::cos(t0)}, _sin{std::sin(t0)}, _cos_dt{std::cos(dt)}, _sin_dt{std::sin(dt)} {};
+
+    double cos() const { return _cos; };
+    double sin() const { return _sin; };
+    double t() const { return _t0 + static_cast<double>(_index) * _dt; };
+
+    void next() {
+        ++_index;
+        if (_index % sincos_resync_interval == 0) {
+            // Re-anchor to bound the accumulated rounding error
+            const double t{this->t()};
+            _cos = std::cos(t);
+            _sin = std::sin(t);
+            return;
+        }
+
+        const double next_cos{_cos * _cos_dt - _sin * _sin_dt};
+        _sin = _sin * _cos_dt + _cos * _sin_dt;
+        _cos = next_cos;
+    };
+
+private:
+    double _t0;
+    double _dt;
+    std::size_t _index{};
+    double _cos;
+    double _sin;
+    double _cos_dt;
+    double _sin_dt;
+};
+
+} // namespace math
+} // namespace curves
+
+#endif // __SinCosSequence_h__
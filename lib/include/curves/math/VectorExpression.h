@@ -0,0 +1,101 @@
+#ifndef __VectorExpression_h__
+#define __VectorExpression_h__
+
+#include "curves/math/CoordStorage.h"
+
+namespace curves {
+namespace math {
+
+// Opt-in expression templates for coordinate arithmetic. lazy() wraps a Vector or Point, arithmetic on the wrapper
+// builds an expression tree, and converting the tree to a Vector or Point evaluates it coordinate by coordinate in
+// one pass, without temporaries for the intermediate results:
+//     const Vector3d offset{(lazy(_axis_x) * cos + lazy(_axis_y) * sin) * _radius};
+// Every coordinate goes through the same operations in the same order as with the eager Vector operators, so the
+// results are bitwise equal. The tree refers to its operands: evaluate it in the full expression that builds it.
+
+template <typename E>
+concept Coord_expression = requires { typename E::coord_expression_tag; };
+
+// Conversion of every expression to the coordinate types of matching dimension
+template <typename Derived, typename T, std::size_t Dim>
+class CoordExpression {
+public:
+    using coord_expression_tag = void;
+    using value_type = T;
+    static constexpr std::size_t dimension{Dim};
+
+    template <typename Result>
+        requires std::derived_from<Result, CoordStorage<T, Dim>>
+    operator Result() const;
+};
+
+template <typename T, std::size_t Dim>
+class CoordReference : public CoordExpression<CoordReference<T, Dim>, T, Dim> {
+public:
+    explicit CoordReference(const CoordStorage<T, Dim>& storage) : _data{storage.data()} {};
+
+    T operator[](std::size_t i) const { return _data[i]; };
+
+private:
+    const std::array<T, Dim>& _data;
+};
+
+template <Coord_expression Left, Coord_expression Right, typename Operation>
+    requires(Left::dimension == Right::dimension)
+class BinaryExpression : public CoordExpression<BinaryExpression<Left, Right, Operation>,
+                             typename Left::value_type,
+                             Left::dimension> {
+public:
+    BinaryExpression(const Left& left, const Right& right) : _left{left}, _right{right} {};
+
+    typename Left::value_type operator[](std::size_t i) const { return Operation{}(_left[i], _right[i]); };
+
+private:
+    Left _left;
+    Right _right;
+};
+
+// Coordinate-wise operation with a scalar on the right side
+template <Coord_expression Expression, typename Operation>
+class ScalarExpression
+    : public CoordExpression<ScalarExpression<Expression, Operation>,
+          typename Expression::value_type,
+          Expression::dimension> {
+public:
+    ScalarExpression(const Expression& expression, typename Expression::value_type scalar)
+        : _expression{expression}, _scalar{scalar} {};
+
+    typename Expression::value_type operator[](std::size_t i) const { return Operation{}(_expression[i], _scalar); };
+
+private:
+    Expression _expression;
+    typename Expression::value_type _scalar;
+};
+
+template <typename T, std::size_t Dim>
+CoordReference<T, Dim> lazy(const CoordStorage<T, Dim>& storage);
+
+template <typename Result, Coord_expression Expression>
+    requires std::derived_from<Result, CoordStorage<typename Expression::value_type, Expression::dimension>>
+Result evaluate(const Expression& expression);
+
+template <Coord_expression Left, Coord_expression Right>
+BinaryExpression<Left, Right, std::plus<>> operator+(const Left& left, const Right& right);
+
+template <Coord_expression Left, Coord_expression Right>
+BinaryExpression<Left, Right, std::minus<>> operator-(const Left& left, const Right& right);
+
+template <Coord_expression Expression>
+ScalarExpression<Expression, std::multiplies<>> operator*(
+    const Expression& expression, typename Expression::value_type scalar);
+
+template <Coord_expression Expression>
+ScalarExpression<Expression, std::divides<>> operator/(
+    const Expression& expression, typename Expression::value_type scalar);
+
+} // namespace math
+} // namespace curves
+
+#include "curves/math/VectorExpression.hpp"
+
+#endif // __VectorExpression_h__
@@ -0,0 +1,49 @@
+namespace curves {
+namespace math {
+
+template <typename Derived, typename T, std::size_t Dim>
+template <typename Result>
+    requires std::derived_from<Result, CoordStorage<T, Dim>>
+CoordExpression<Derived, T, Dim>::operator Result() const {
+    return evaluate<Result>(static_cast<const Derived&>(*this));
+}
+
+template <typename T, std::size_t Dim>
+CoordReference<T, Dim> lazy(const CoordStorage<T, Dim>& storage) {
+    return CoordReference<T, Dim>{storage};
+}
+
+template <typename Result, Coord_expression Expression>
+    requires std::derived_from<Result, CoordStorage<typename Expression::value_type, Expression::dimension>>
+Result evaluate(const Expression& expression) {
+    Result result{};
+    for (std::size_t i{}; i < Expression::dimension; ++i) {
+        result.data()[i] = expression[i];
+    }
+    return result;
+}
+
+template <Coord_expression Left, Coord_expression Right>
+BinaryExpression<Left, Right, std::plus<>> operator+(const Left& left, const Right& right) {
+    return {left, right};
+}
+
+template <Coord_expression Left, Coord_expression Right>
+BinaryExpression<Left, Right, std::minus<>> operator-(const Left& left, const Right& right) {
+    return {left, right};
+}
+
+template <Coord_expression Expression>
+ScalarExpression<Expression, std::multiplies<>> operator*(
+    const Expression& expression, typename Expression::value_type scalar) {
+    return {expression, scalar};
+}
+
+template <Coord_expression Expression>
+ScalarExpression<Expression, std::divides<>> operator/(
+    const Expression& expression, typename Expression::value_type scalar) {
+    return {expression, scalar};
+}
+
+} // namespace math
+} // namespace curves
@@ -2,6 +2,7 @@
 #define __Circle_h__
 
 #include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveEvaluation.h"
 
 #include "curves/math/Point.h"
 #include "curves/math/Vector.h"
@@ -19,9 +20,16 @@ public:
 
     Point3d get_point(double t) const override;
     Vector3d get_first_derivative(double t) const override;
+    CurveEvaluation evaluate(double t, std::size_t order = 1) const override;
+    void evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const override;
+    void sample_uniform(double t0, double dt, std::span<Point3d> out) const override;
+    double get_max_acceleration() const override;
 
     bool belongs(const Point3d& point, double precision) const;
 
+    // Parameter of the point projected onto the circle plane, in [0, 2pi)
+    double get_parameter(const Point3d& point) const;
+
     const Point3d& get_center() const { return _center; };
     double get_radius() const { return _radius; };
     const Vector3d& get_axis() const { return _axis; };
@@ -0,0 +1,91 @@
+#ifndef __CompactCurveBlock_h__
+#define __CompactCurveBlock_h__
+
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+#include "curves/model3d/CurveFactory.h"
+
+namespace curves {
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+class Curve;
+
+// Quantized curve, 32 bytes instead of the 120 bytes of a center and three frame vectors in doubles
+struct CompactCurve {
+    std::uint64_t frame; // Rotation (U, V, N) as a "smallest three" quaternion: 2-bit index + 3 x 20-bit components
+    std::array<std::uint32_t, 3> center; // Relative to the block origin, in units of the center step
+    std::uint32_t size_a; // Circle and helix radius, ellipse semi-major axis
+    std::uint32_t size_b; // Ellipse semi-minor axis, helix step, unused for a circle
+    std::uint8_t type; // CurveFactory::Curve_type
+    std::array<std::uint8_t, 3> reserved; // Zero, so that no undefined padding bytes are written out
+};
+
+static_assert(sizeof(CompactCurve) == 32);
+
+// Block of curves stored in the compact form. Centers are quantized relative to the bounding box of the block and
+// sizes from zero, both so that every decoded center and size is within max_error of the original.
+// Curves are evaluated directly from the compact form, the frame is decoded on the fly.
+//
+// A decoded point differs from the original by at most
+//     2 * max_error + get_frame_error() * (size + |height|) (+ max_error * |t| / 2pi for a helix)
+// where height is the helix rise at t: the step error accumulates over the turns.
+class CompactCurveBlock {
+public:
+    // Bound of the rotation angle between the decoded frame and the original one for any block
+    // (20-bit quaternion components)
+    static constexpr double frame_angular_error{5e-6};
+
+    // nullopt if a curve is not a Circle, Ellipse or Helix or if max_error cannot be met with 32-bit codes
+    static std::optional<CompactCurveBlock> encode(std::span<const std::shared_ptr<Curve>> curves, double max_error);
+
+    std::size_t size() const { return _curves.size(); };
+    double get_max_error() const { return _max_error; };
+    // Largest rotation angle between a decoded frame and the original one in this block, measured on encoding
+    double get_frame_error() const { return _frame_error; };
+    const std::vector<CompactCurve>& get_curves() const { return _curves; };
+
+    CurveFactory::Curve_type get_type(std::size_t index) const {
+        return static_cast<CurveFactory::Curve_type>(_curves[index].type);
+    };
+    Point3d get_point(std::size_t index, double t) const;
+    Vector3d get_first_derivative(std::size_t index, double t) const;
+
+    // Full curve built from the decoded parameters
+    std::shared_ptr<Curve> decode(std::size_t index) const;
+
+    // Binary form: block header followed by the raw records, in the byte order of the machine.
+    // read returns nullopt on a truncated stream or a foreign header; the records are read in chunks, so a corrupt
+    // count fails at the end of the stream instead of allocating it up front.
+    void write(std::ostream& os) const;
+    static std::optional<CompactCurveBlock> read(std::istream& is);
+
+private:
+    struct Decoded_curve {
+        Point3d center;
+        double size_a;
+        double size_b;
+        Vector3d axis_x;
+        Vector3d axis_y;
+        Vector3d axis;
+    };
+
+    CompactCurveBlock(
+        const Point3d& origin, double center_step, double size_step, double max_error, double frame_error);
+
+    Decoded_curve decode_parameters(std::size_t index) const;
+
+    Point3d _origin;
+    double _center_step;
+    double _size_step;
+    double _max_error;
+    double _frame_error;
+    std::vector<CompactCurve> _curves;
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CompactCurveBlock_h__
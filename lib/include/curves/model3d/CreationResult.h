@@ -0,0 +1,80 @@
+#ifndef __CreationResult_h__
+#define __CreationResult_h__
+
+namespace curves {
+namespace model3d {
+
+// Reason why a curve could not be created. Kept compact so it can be stored per item in bulk jobs.
+enum class Creation_error : std::uint8_t {
+    none,
+    invalid_radius, // values: {radius}
+    invalid_semi_axes, // values: {radius_major, radius_minor}
+    invalid_helix_parameters, // values: {radius, step}
+    degenerate_normal, // values: plane normal or helix axis {x, y, z}
+    degenerate_direction, // values: start or major direction {x, y, z}
+    non_perpendicular_frame, // values: {scalar product of the normalized vectors}
+    mismatched_batch_sizes, // values: {shortest array length, longest array length} of a bulk creation input
+    invalid_curve_type, // values: {curve type index}
+    size
+};
+
+const char* to_string(Creation_error error);
+
+// Error code together with the offending input values. Trivially copyable, no allocation.
+struct CreationFailure {
+    Creation_error error{Creation_error::none};
+    std::array<double, 3> values{};
+};
+
+std::ostream& operator<<(std::ostream& os, const CreationFailure& failure);
+
+// Either a created value or the reason of the failure (std::expected is not available in C++20).
+template <typename T>
+class CreationResult {
+public:
+    CreationResult(T value) : _storage{std::in_place_index<0>, std::move(value)} {};
+    CreationResult(const CreationFailure& failure) : _storage{std::in_place_index<1>, failure} {};
+
+    bool has_value() const { return _storage.index() == 0; };
+    explicit operator bool() const { return has_value(); };
+
+    const T& value() const& { return std::get<0>(_storage); };
+    T& value() & { return std::get<0>(_storage); };
+    T&& value() && { return std::get<0>(std::move(_storage)); };
+
+    const T& operator*() const& { return value(); };
+    T& operator*() & { return value(); };
+    const T* operator->() const { return &value(); };
+    T* operator->() { return &value(); };
+
+    // Valid only when has_value() is false
+    const CreationFailure& failure() const { return std::get<1>(_storage); };
+    Creation_error error() const { return has_value() ? Creation_error::none : failure().error; };
+
+private:
+    std::variant<T, CreationFailure> _storage;
+};
+
+// Per error code counters. Cheap to keep one per thread and merge at the end of a bulk job.
+class CreationStats {
+public:
+    void record(Creation_error error);
+    template <typename T>
+    void record(const CreationResult<T>& result) {
+        record(result.error());
+    }
+
+    std::size_t get_count(Creation_error error) const;
+    std::size_t get_total_count() const;
+    std::size_t get_failure_count() const;
+
+    CreationStats& operator+=(const CreationStats& other);
+
+private:
+    std::array<std::size_t, static_cast<std::size_t>(Creation_error::size)> _counts{};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CreationResult_h__
@@ -17,12 +17,45 @@ namespace model3d {
 using Point3d = math::Point<double, 3>;
 using Vector3d = math::Vector<double, 3>;
 
+struct CurveEvaluation;
+
 class Curve {
 public:
+    Curve();
+    Curve(const Curve& other);
+    Curve& operator=(const Curve& other);
     virtual ~Curve() = default;
 
+    // Identity of the curve object, never reused while the process runs. A copy gets its own identity,
+    // and so does a curve assigned a new geometry, so caches keyed by it never see stale data.
+    std::uint64_t get_id() const { return _id; };
+
     virtual Point3d get_point(double t) const = 0;
     virtual Vector3d get_first_derivative(double t) const = 0;
+
+    // Point and derivatives up to order (at most max_evaluation_order) at t. Circle, Ellipse and Helix compute
+    // sin(t) and cos(t) once for all of them; the generic version below combines get_point and
+    // get_first_derivative and differentiates the latter numerically for the second order.
+    virtual CurveEvaluation evaluate(double t, std::size_t order = 1) const;
+    // evaluate for every parameter, out[i] for t[i]; out must not be shorter than t
+    virtual void evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const;
+
+    // Writes P(t0 + i * dt) to out[i] for every element of out.
+    // Circle, Ellipse and Helix use an incremental sin/cos recurrence instead of evaluating every sample
+    // from scratch, the result differs from get_point by less than math::precision (see math::SinCosSequence).
+    virtual void sample_uniform(double t0, double dt, std::span<Point3d> out) const;
+
+    // Upper bound of |P''(t)| over all t. A chord over a parameter interval h deviates from the curve
+    // by at most get_max_acceleration() * h^2 / 8.
+    // Circle, Ellipse and Helix return the exact bound. The generic version estimates it from get_first_derivative
+    // sampled over [0, 2pi] with a safety margin: it assumes the acceleration repeats with period 2pi, like for
+    // every curve of the library, and has no peak narrower than the sampling step.
+    virtual double get_max_acceleration() const;
+
+private:
+    static std::uint64_t generate_id();
+
+    std::uint64_t _id;
 };
 
 } // namespace model3d
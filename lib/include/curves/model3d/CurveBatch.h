@@ -0,0 +1,74 @@
+#ifndef __CurveBatch_h__
+#define __CurveBatch_h__
+
+#include "curves/model3d/CreationResult.h"
+
+namespace curves {
+namespace model3d {
+
+// Structure-of-arrays view of 3D vectors or points: x[i], y[i], z[i] describe the i-th item.
+struct BatchVectors {
+    std::span<const double> x;
+    std::span<const double> y;
+    std::span<const double> z;
+
+    std::size_t get_min_size() const { return std::min({x.size(), y.size(), z.size()}); };
+    std::size_t get_max_size() const { return std::max({x.size(), y.size(), z.size()}); };
+};
+
+// Bulk creation inputs. The start (major) direction is derived from the normal (axis)
+// the same way as in the single-curve factory functions.
+// All arrays must have the same length: size() is the longest one, get_min_size() the shortest one, and a batch
+// where they differ is rejected as a whole with Creation_error::mismatched_batch_sizes.
+struct CircleBatchInput {
+    BatchVectors centers;
+    std::span<const double> radii;
+    BatchVectors normals;
+
+    std::size_t size() const { return std::max({centers.get_max_size(), radii.size(), normals.get_max_size()}); };
+    std::size_t get_min_size() const {
+        return std::min({centers.get_min_size(), radii.size(), normals.get_min_size()});
+    };
+};
+
+struct EllipseBatchInput {
+    BatchVectors centers;
+    std::span<const double> radii_major;
+    std::span<const double> radii_minor;
+    BatchVectors normals;
+
+    std::size_t size() const {
+        return std::max({centers.get_max_size(), radii_major.size(), radii_minor.size(), normals.get_max_size()});
+    };
+    std::size_t get_min_size() const {
+        return std::min({centers.get_min_size(), radii_major.size(), radii_minor.size(), normals.get_min_size()});
+    };
+};
+
+struct HelixBatchInput {
+    BatchVectors centers;
+    std::span<const double> radii;
+    std::span<const double> steps;
+    BatchVectors axes;
+
+    std::size_t size() const {
+        return std::max({centers.get_max_size(), radii.size(), steps.size(), axes.get_max_size()});
+    };
+    std::size_t get_min_size() const {
+        return std::min({centers.get_min_size(), radii.size(), steps.size(), axes.get_min_size()});
+    };
+};
+
+// Result of a bulk creation. curves holds the successfully created curves contiguously, in input order;
+// status has one entry per input item (Creation_error::none for items that produced a curve).
+template <typename T>
+struct CurveBatch {
+    std::vector<T> curves;
+    std::vector<Creation_error> status;
+    CreationStats stats;
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CurveBatch_h__
@@ -0,0 +1,25 @@
+#ifndef __CurveEvaluation_h__
+#define __CurveEvaluation_h__
+
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+
+namespace curves {
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+inline constexpr std::size_t max_evaluation_order{2};
+
+// Point and derivatives at one parameter (see Curve::evaluate). Derivatives above the requested order are zero.
+struct CurveEvaluation {
+    Point3d point{};
+    Vector3d first_derivative{};
+    Vector3d second_derivative{};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CurveEvaluation_h__
@@ -1,6 +1,9 @@
 #ifndef __CurveFactory_h__
 #define __CurveFactory_h__
 
+#include "curves/model3d/CreationResult.h"
+#include "curves/model3d/CurveBatch.h"
+
 namespace curves {
 namespace math {
 template <typename T, std::size_t Dim>
@@ -17,6 +20,7 @@ namespace model3d {
 using Point3d = math::Point<double, 3>;
 using Vector3d = math::Vector<double, 3>;
 
+class AllocationTracker;
 class Curve;
 class Circle;
 class Ellipse;
@@ -66,7 +70,56 @@ public:
         bool log_error = false);
     static std::shared_ptr<Helix> create_random_helix(bool log_error = false);
 
+    // Non-logging counterparts of the functions above: no I/O, the failure reason is returned to the caller
+    static CreationResult<std::shared_ptr<Circle>> try_create_circle(
+        const Point3d& center, double radius, const Vector3d& plane_normal);
+    static CreationResult<std::shared_ptr<Circle>> try_create_circle(
+        const Point3d& center, double radius, const Vector3d& plane_normal, const Vector3d& start_direction);
+
+    static CreationResult<std::shared_ptr<Ellipse>> try_create_ellipse(
+        const Point3d& center, double radius_major, double radius_minor, const Vector3d& plane_normal);
+    static CreationResult<std::shared_ptr<Ellipse>> try_create_ellipse(const Point3d& center,
+        double radius_major,
+        double radius_minor,
+        const Vector3d& plane_normal,
+        const Vector3d& major_direction);
+
+    static CreationResult<std::shared_ptr<Helix>> try_create_helix(
+        const Point3d& center, double radius, double step);
+    static CreationResult<std::shared_ptr<Helix>> try_create_helix(
+        const Point3d& center, double radius, double step, const Vector3d& axis);
+    static CreationResult<std::shared_ptr<Helix>> try_create_helix(const Point3d& center,
+        double radius,
+        double step,
+        const Vector3d& axis,
+        const Vector3d& start_direction);
+
+    // Invalid curve type (Curve_type::size or a value outside the enumeration) fails with invalid_curve_type
+    static CreationResult<std::shared_ptr<Curve>> try_create_random_curve_by_type(Curve_type curve_type);
+    static CreationResult<std::shared_ptr<Circle>> try_create_random_circle();
+    static CreationResult<std::shared_ptr<Ellipse>> try_create_random_ellipse();
+    static CreationResult<std::shared_ptr<Helix>> try_create_random_helix();
+
+    // Bulk creation from structure-of-arrays input. Validation, normalization and frame construction run as
+    // separate branch-free passes over contiguous arrays so that the compiler can vectorize them.
+    // The output is cleared and refilled, its storage is reused between calls.
+    static void create_circles(const CircleBatchInput& input, CurveBatch<Circle>& output);
+    static void create_ellipses(const EllipseBatchInput& input, CurveBatch<Ellipse>& output);
+    static void create_helices(const HelixBatchInput& input, CurveBatch<Helix>& output);
+
+    // Optional peak tracking hook: curves created while a tracker is installed report their estimated
+    // heap footprint to it on creation and destruction. nullptr uninstalls the tracker.
+    static void set_allocation_tracker(AllocationTracker* tracker);
+
 private:
+    template <typename T, typename... Args>
+    static std::shared_ptr<T> make_curve(Args&&... args);
+
+    template <typename T>
+    static std::shared_ptr<T> unwrap(CreationResult<std::shared_ptr<T>>&& result, bool log_error);
+
+    inline static std::atomic<AllocationTracker*> allocation_tracker{nullptr};
+
     // RANDOM
     inline static std::mt19937_64 random_generator{std::random_device{}()};
 
@@ -0,0 +1,71 @@
+#ifndef __CurveProxy_h__
+#define __CurveProxy_h__
+
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+
+namespace curves {
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+class Curve;
+struct MemoryUsage;
+
+// Accuracy of a proxy relative to the size of the curve (the largest radius), see get_relative_tolerance
+enum class Approximation_tier { preview, standard, precise, size };
+
+double get_relative_tolerance(Approximation_tier tier);
+
+// Polynomial stand-in for get_point and get_first_derivative of a circle, ellipse or helix. One turn [0, 2pi) is
+// split into equal intervals with a Chebyshev series of fixed degree per interval and coordinate; the number of
+// intervals is doubled until the error measured against the curve meets the tolerance. The series fit P(t) - C, so
+// the accuracy does not depend on where the curve is; a helix is also fitted without its axial term, one turn serves
+// every turn. The center and the axial shift are added back on evaluation.
+// Evaluation is branch-free Clenshaw recurrence without trigonometric calls.
+class CurveProxy {
+public:
+    static constexpr std::size_t degree{12};
+    static constexpr std::size_t max_interval_count{1024};
+
+    // nullopt for curve types other than circle, ellipse and helix, and if max_interval_count intervals do not meet
+    // the tolerance (absolute, for points and first derivatives).
+    static std::optional<CurveProxy> build(const Curve& curve, double tolerance);
+    static std::optional<CurveProxy> build(const Curve& curve, Approximation_tier tier);
+
+    Point3d get_point(double t) const;
+    Vector3d get_first_derivative(double t) const;
+    // Writes the proxy point at t0 + i * dt to out[i] for every element of out
+    void sample_uniform(double t0, double dt, std::span<Point3d> out) const;
+
+    std::size_t get_interval_count() const { return _interval_count; };
+    // Largest deviation from the curve seen at the check samples, for points and first derivatives. Points are
+    // compared as offsets from the center; the absolute coordinates add their own rounding on top.
+    double get_point_error() const { return _point_error; };
+    double get_derivative_error() const { return _derivative_error; };
+
+    friend MemoryUsage memory_usage(const CurveProxy& proxy);
+
+private:
+    CurveProxy() = default;
+
+    // Interval of the angle and the local coordinate x in [-1, 1]
+    std::size_t get_interval(double angle, double& x) const;
+    Vector3d evaluate_series(const std::vector<double>& coefficients, std::size_t interval, double x) const;
+    double get_angle(double t) const;
+
+    std::vector<double> _point_coefficients; // [interval][coordinate][degree + 1]
+    std::vector<double> _derivative_coefficients;
+    std::size_t _interval_count{};
+    double _interval_scale{}; // Intervals per radian
+    Point3d _center{};
+    Vector3d _axis_shift{}; // Axial offset per radian, zero for closed curves
+    double _point_error{};
+    double _derivative_error{};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CurveProxy_h__
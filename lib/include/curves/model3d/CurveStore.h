@@ -0,0 +1,53 @@
+#ifndef __CurveStore_h__
+#define __CurveStore_h__
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/model3d/MemoryUsage.h"
+
+namespace curves {
+namespace model3d {
+
+// Contiguous copy of a curve population: one exactly sized array per curve type and an order table,
+// four allocations instead of two per curve. The store is immutable, so the curves never move
+// and keep their identities (Curve::get_id) for the lifetime of the store.
+class CurveStore {
+public:
+    struct Entry {
+        CurveFactory::Curve_type type;
+        std::uint32_t index; // Into the array of the type
+    };
+
+    CurveStore() = default;
+
+    // Repacks the curves in their order; nullopt if a curve is not a Circle, Ellipse or Helix.
+    // The copies get new identities.
+    static std::optional<CurveStore> compact(std::span<const std::shared_ptr<Curve>> curves);
+
+    // Copy holding curve order[i] of this store at position i, e.g. a spatial order (see index::SpatialOrder).
+    // order must be a permutation of [0, size()); the copies get new identities.
+    CurveStore reordered(std::span<const std::uint32_t> order) const;
+
+    std::size_t size() const { return _entries.size(); };
+    const Curve& operator[](std::size_t index) const;
+
+    std::span<const Circle> get_circles() const { return _circles; };
+    std::span<const Ellipse> get_ellipses() const { return _ellipses; };
+    std::span<const Helix> get_helices() const { return _helices; };
+    std::span<const Entry> get_entries() const { return _entries; };
+
+    friend MemoryUsage memory_usage(const CurveStore& store);
+
+private:
+    std::vector<Circle> _circles;
+    std::vector<Ellipse> _ellipses;
+    std::vector<Helix> _helices;
+    std::vector<Entry> _entries;
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __CurveStore_h__
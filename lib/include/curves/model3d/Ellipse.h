@@ -2,6 +2,7 @@
 #define __Ellipse_h__
 
 #include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveEvaluation.h"
 
 #include "curves/math/Point.h"
 #include "curves/math/Vector.h"
@@ -19,6 +20,17 @@ public:
 
     Point3d get_point(double t) const override;
     Vector3d get_first_derivative(double t) const override;
+    CurveEvaluation evaluate(double t, std::size_t order = 1) const override;
+    void evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const override;
+    void sample_uniform(double t0, double dt, std::span<Point3d> out) const override;
+    double get_max_acceleration() const override;
+
+    const Point3d& get_center() const { return _center; };
+    double get_radius_major() const { return _radius_major; };
+    double get_radius_minor() const { return _radius_minor; };
+    const Vector3d& get_axis() const { return _axis; };
+    const Vector3d& get_axis_x() const { return _axis_x; };
+    const Vector3d& get_axis_y() const { return _axis_y; };
 
 private:
     explicit Ellipse(const Point3d& center,
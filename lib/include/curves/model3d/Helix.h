@@ -2,6 +2,7 @@
 #define __Helix_h__
 
 #include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveEvaluation.h"
 
 #include "curves/math/Point.h"
 #include "curves/math/Vector.h"
@@ -13,12 +14,31 @@ namespace model3d {
 using Point3d = math::Point<double, 3>;
 using Vector3d = math::Vector<double, 3>;
 
+// Helix parameter split into full turns and the angle within the turn: t = 2pi * turn + angle.
+// Keeps the angle exact for helices with millions of turns, where t itself has lost the fractional digits.
+struct HelixParameter {
+    std::int64_t turn;
+    double angle; // [0, 2pi)
+};
+
 class Helix : public Curve {
 public:
     ~Helix() override;
 
     Point3d get_point(double t) const override;
     Vector3d get_first_derivative(double t) const override;
+    CurveEvaluation evaluate(double t, std::size_t order = 1) const override;
+    void evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const override;
+
+    Point3d get_point(const HelixParameter& parameter) const;
+    Vector3d get_first_derivative(const HelixParameter& parameter) const;
+    CurveEvaluation evaluate(const HelixParameter& parameter, std::size_t order = 1) const;
+
+    // Reduces t to (turn, angle) once; the result is used by both the trigonometric and the axial terms.
+    // The angle is NaN, so are the points evaluated from it, if t is not finite or the turn exceeds 64 bits.
+    static HelixParameter split_parameter(double t);
+    void sample_uniform(double t0, double dt, std::span<Point3d> out) const override;
+    double get_max_acceleration() const override;
 
     const Point3d& get_center() const { return _center; };
     double get_radius() const { return _radius; };
@@ -0,0 +1,120 @@
+#ifndef __MemoryUsage_h__
+#define __MemoryUsage_h__
+
+#include "curves/model3d/CurveBatch.h"
+
+namespace curves {
+
+namespace index {
+class RadiusBTree;
+class RadiusIndex;
+} // namespace index
+
+namespace intersection3d {
+class CircleAxisIndex;
+} // namespace intersection3d
+
+namespace parallel {
+class CurveRegistry;
+class PartitionedCurveStore;
+} // namespace parallel
+
+namespace model3d {
+
+class Curve;
+class CompactCurveBlock;
+class CurveProxy;
+class CurveStore;
+class SharedCurveStore;
+class TessellationCache;
+
+// Heap footprint split by purpose. Payload is exact, the rest is modelled on glibc malloc
+// and the libstdc++ node and control block layouts.
+struct MemoryUsage {
+    std::size_t payload{}; // Curve objects, compact records, tessellation points
+    std::size_t allocator_overhead{}; // malloc chunk headers and padding, shared_ptr control blocks, unused capacity
+    std::size_t index{}; // Pointer arrays, order tables, status arrays, hash and list nodes
+
+    std::size_t get_total() const { return payload + allocator_overhead + index; };
+
+    MemoryUsage& operator+=(const MemoryUsage& other);
+};
+
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage);
+
+// Bytes malloc spends on top of a request of size bytes: the chunk header and the rounding
+// to 16 bytes, with a minimum chunk of 32 bytes. No overhead for an empty request.
+std::size_t get_allocation_overhead(std::size_t size);
+
+// Object of object_size bytes created the way the factory does it: shared_ptr{new T}, i.e. the object and
+// the control block are two separate allocations
+MemoryUsage get_shared_object_usage(std::size_t object_size);
+
+// Buffer of a vector, size elements counted as payload or index, the unused capacity as overhead
+template <typename T>
+MemoryUsage get_buffer_usage(const std::vector<T>& buffer, bool is_payload) {
+    const std::size_t used{buffer.size() * sizeof(T)};
+    const std::size_t allocated{buffer.capacity() * sizeof(T)};
+
+    MemoryUsage usage;
+    (is_payload ? usage.payload : usage.index) = used;
+    usage.allocator_overhead = allocated - used + get_allocation_overhead(allocated);
+    return usage;
+}
+
+// The curve object alone
+MemoryUsage memory_usage(const Curve& curve);
+// Pointer array plus every curve with its control block; a curve shared by several pointers is counted once
+MemoryUsage memory_usage(const std::vector<std::shared_ptr<Curve>>& curves);
+MemoryUsage memory_usage(const CompactCurveBlock& block);
+MemoryUsage memory_usage(const CurveStore& store);
+MemoryUsage memory_usage(const TessellationCache& cache);
+MemoryUsage memory_usage(const CurveProxy& proxy);
+// The mapped segment, which is shared memory rather than heap: records as payload, slot and segment headers as
+// index, the rounding to pages as overhead
+MemoryUsage memory_usage(const SharedCurveStore& store);
+MemoryUsage memory_usage(const parallel::PartitionedCurveStore& store);
+
+// Indices over curves owned by the caller count their own structures only, not the curves
+MemoryUsage memory_usage(const index::RadiusIndex& index);
+MemoryUsage memory_usage(const index::RadiusBTree& tree);
+MemoryUsage memory_usage(const intersection3d::CircleAxisIndex& index);
+
+// Slot segments, entry nodes, nodes awaiting reclamation and participants, plus every registered curve with its
+// control block, counted once. Must not run concurrently with remove or collect.
+MemoryUsage memory_usage(const parallel::CurveRegistry& registry);
+
+template <typename T>
+MemoryUsage memory_usage(const CurveBatch<T>& batch) {
+    MemoryUsage usage{get_buffer_usage(batch.curves, true)};
+    usage += get_buffer_usage(batch.status, false);
+    return usage;
+}
+
+// Live and peak bytes of the curves created by the factory while the tracker is installed
+// (CurveFactory::set_allocation_tracker), estimated with get_shared_object_usage.
+// The tracker must outlive every curve it has seen: the deleters of those curves report to it.
+class AllocationTracker {
+public:
+    void on_allocate(std::size_t bytes);
+    void on_release(std::size_t bytes);
+
+    std::size_t get_current_bytes() const { return _current_bytes.load(std::memory_order_relaxed); };
+    std::size_t get_peak_bytes() const { return _peak_bytes.load(std::memory_order_relaxed); };
+    std::size_t get_live_count() const { return _live_count.load(std::memory_order_relaxed); };
+    std::size_t get_allocation_count() const { return _allocation_count.load(std::memory_order_relaxed); };
+
+    // Starts a new measurement window: the peak becomes the current usage
+    void reset_peak();
+
+private:
+    std::atomic<std::size_t> _current_bytes{};
+    std::atomic<std::size_t> _peak_bytes{};
+    std::atomic<std::size_t> _live_count{};
+    std::atomic<std::size_t> _allocation_count{};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __MemoryUsage_h__
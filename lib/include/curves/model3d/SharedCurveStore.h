@@ -0,0 +1,124 @@
+#ifndef __SharedCurveStore_h__
+#define __SharedCurveStore_h__
+
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+#include "curves/model3d/CurveFactory.h"
+
+namespace curves {
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+class Curve;
+class CurveStore;
+struct MemoryUsage;
+
+// Curve parameters as laid out in a shared segment: plain values, no pointers or vtables,
+// so the record means the same in every process that maps it
+struct SharedCurveRecord {
+    std::array<double, 3> center;
+    double size_a; // Circle and helix radius, ellipse semi-major axis
+    double size_b; // Ellipse semi-minor axis, helix step, 0 for a circle
+    std::array<double, 3> axis_x;
+    std::array<double, 3> axis_y;
+    std::array<double, 3> axis;
+    std::uint64_t type; // CurveFactory::Curve_type
+};
+
+static_assert(sizeof(SharedCurveRecord) == 120);
+
+// Snapshot of a SharedCurveStore, read in place from the mapped segment. Must not outlive its store.
+// Reading is optimistic: the writer may start overwriting the snapshot two publications later, so results computed
+// from the view are only to be trusted if is_valid() still holds after they were computed.
+class SharedCurveView {
+public:
+    std::size_t size() const { return _records.size(); };
+    std::uint64_t get_version() const { return _version; };
+    std::span<const SharedCurveRecord> get_records() const { return _records; };
+
+    CurveFactory::Curve_type get_type(std::size_t index) const {
+        return static_cast<CurveFactory::Curve_type>(_records[index].type);
+    };
+    Point3d get_point(std::size_t index, double t) const;
+    Vector3d get_first_derivative(std::size_t index, double t) const;
+
+    // Full curve built from the record, a new identity in the heap of this process
+    std::shared_ptr<Curve> decode(std::size_t index) const;
+
+    // The snapshot has not been touched by the writer since the view was taken
+    bool is_valid() const;
+
+private:
+    friend class SharedCurveStore;
+
+    SharedCurveView(const std::atomic<std::uint64_t>* sequence,
+        std::uint64_t expected_sequence,
+        std::uint64_t version,
+        std::span<const SharedCurveRecord> records);
+
+    const std::atomic<std::uint64_t>* _sequence;
+    std::uint64_t _expected_sequence;
+    std::uint64_t _version;
+    std::span<const SharedCurveRecord> _records;
+};
+
+// Curve set in a POSIX shared memory segment (shm_open), for worker processes on one host that need the same
+// curves without each building its own heap copy. The segment holds two snapshot slots of a fixed capacity with
+// offsets relative to the segment, so it may be mapped at any address. One writer process publishes versioned
+// snapshots into the slot not holding the latest one; readers map the segment read-only and take views of the
+// latest snapshot. Every slot carries a sequence counter that is odd while the slot is written (a seqlock),
+// which is how readers detect a snapshot overwritten under them. POSIX systems only, elsewhere create and open fail.
+class SharedCurveStore {
+public:
+    // Creates the segment (name as for shm_open, "/name"), replacing an existing one; readers that mapped the old
+    // segment keep it. capacity is the number of curves per snapshot.
+    static std::optional<SharedCurveStore> create(const std::string& name, std::size_t capacity);
+    // Maps an existing segment read-only, nullopt if it does not exist or has a foreign layout
+    static std::optional<SharedCurveStore> open(const std::string& name);
+    // Removes the name, mappings stay valid until they are closed
+    static bool remove(const std::string& name);
+
+    SharedCurveStore(SharedCurveStore&& other) noexcept;
+    SharedCurveStore& operator=(SharedCurveStore&& other) noexcept;
+    ~SharedCurveStore();
+
+    SharedCurveStore(const SharedCurveStore& other) = delete;
+    SharedCurveStore& operator=(const SharedCurveStore& other) = delete;
+
+    bool is_writable() const { return _writable; };
+    std::size_t get_capacity() const;
+    // Latest published version, 0 before the first publication
+    std::uint64_t get_version() const;
+
+    // Publishes the curves as the next version and returns it. nullopt on a read-only mapping, if the curves exceed
+    // the capacity or one is not a Circle, Ellipse or Helix; the latest snapshot is then left as it was.
+    // Must be called from one thread of one process at a time.
+    std::optional<std::uint64_t> publish(std::span<const std::shared_ptr<Curve>> curves);
+    std::optional<std::uint64_t> publish(const CurveStore& store);
+
+    // View of the latest snapshot, nullopt if none is published or the writer kept overwriting it
+    std::optional<SharedCurveView> get_snapshot() const;
+
+    friend MemoryUsage memory_usage(const SharedCurveStore& store);
+
+private:
+    struct SegmentHeader;
+    struct SlotHeader;
+
+    SharedCurveStore(void* data, std::size_t size, bool writable);
+
+    const SegmentHeader& get_header() const;
+    SlotHeader& get_slot(std::size_t slot) const;
+    std::optional<std::uint64_t> publish(std::size_t count, const std::function<const Curve&(std::size_t)>& get_curve);
+
+    void* _data{nullptr};
+    std::size_t _size{};
+    bool _writable{false};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __SharedCurveStore_h__
@@ -0,0 +1,90 @@
+#ifndef __TessellationCache_h__
+#define __TessellationCache_h__
+
+namespace curves {
+namespace math {
+template <typename T, std::size_t Dim>
+    requires std::is_arithmetic_v<T>
+class Point;
+} // namespace math
+
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+
+class Curve;
+struct MemoryUsage;
+
+// Thread-safe, memory-bounded LRU cache of uniform tessellations.
+// Entries are keyed by the curve identity (Curve::get_id), the parameter range and the level of detail:
+// level L holds 2^L segments, the smallest power of two whose chord error meets the requested tolerance.
+// A coarser level is derived from a cached finer one by taking every 2^k-th point, without evaluating the curve.
+class TessellationCache {
+public:
+    using Points = std::shared_ptr<const std::vector<Point3d>>;
+
+    static constexpr std::uint32_t max_level{24};
+    static constexpr std::uint32_t max_derivation_distance{4}; // How many finer levels are checked for derivation
+
+    explicit TessellationCache(std::size_t max_memory);
+
+    TessellationCache(const TessellationCache& other) = delete;
+    TessellationCache& operator=(const TessellationCache& other) = delete;
+
+    // Points P(t0 + i * (t1 - t0) / 2^L), i in [0, 2^L], L = get_level(curve, t0, t1, tolerance).
+    // The returned points stay valid after eviction. nullptr if the tolerance is not positive.
+    Points get(const Curve& curve, double t0, double t1, double tolerance);
+
+    // Drops every cached tessellation of the curve
+    void invalidate(const Curve& curve);
+    void clear();
+
+    std::size_t get_memory_usage() const;
+    std::size_t get_max_memory() const { return _max_memory; };
+    std::size_t get_size() const;
+
+    // nullopt if the tolerance is not positive (or NaN); no level can meet it
+    static std::optional<std::uint32_t> get_level(const Curve& curve, double t0, double t1, double tolerance);
+
+    friend MemoryUsage memory_usage(const TessellationCache& cache);
+
+private:
+    struct Key {
+        std::uint64_t curve_id;
+        double t0;
+        double t1;
+        std::uint32_t level;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct Key_hash {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        Points points;
+        std::size_t memory;
+    };
+
+    using Lru_list = std::list<Entry>;
+
+    // Must be called with _mutex locked
+    Points find(const Key& key);
+    Points derive_from_finer(const Key& key);
+    void insert(const Key& key, const Points& points);
+    void erase(Lru_list::iterator entry);
+    void evict();
+
+    const std::size_t _max_memory;
+    mutable std::mutex _mutex;
+    Lru_list _lru; // Most recently used first
+    std::unordered_map<Key, Lru_list::iterator, Key_hash> _entries;
+    std::size_t _memory_usage{};
+};
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __TessellationCache_h__
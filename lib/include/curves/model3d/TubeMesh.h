@@ -0,0 +1,83 @@
+#ifndef __TubeMesh_h__
+#define __TubeMesh_h__
+
+#include "curves/math/Constants.h"
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+
+namespace curves {
+
+namespace parallel {
+class Executor;
+} // namespace parallel
+
+namespace model3d {
+
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+class Curve;
+
+// Circular profile swept along [t0, t1] of a curve
+struct TubeParameters {
+    double profile_radius;
+    double tolerance; // Distance between the mesh and the exact tube
+    double t0{0.0};
+    double t1{math::two_pi};
+};
+
+// Mesh of one curve: rings of sides vertices at uniform parameters, the ends are left open.
+// A closed curve swept over a full period gets a last ring on top of the first one.
+struct TubeMeshSize {
+    std::uint32_t rings;
+    std::uint32_t sides;
+
+    std::size_t get_vertex_count() const { return std::size_t{rings} * sides; };
+    std::size_t get_index_count() const { return rings < 2 ? 0 : 6 * std::size_t{rings - 1} * sides; };
+};
+
+// Where the mesh of every curve goes in the shared buffers, prefix sums with a final total
+struct TubeMeshLayout {
+    std::vector<TubeMeshSize> sizes;
+    std::vector<std::size_t> vertex_offsets;
+    std::vector<std::size_t> index_offsets;
+
+    std::size_t get_vertex_count() const { return vertex_offsets.empty() ? 0 : vertex_offsets.back(); };
+    std::size_t get_index_count() const { return index_offsets.empty() ? 0 : index_offsets.back(); };
+};
+
+// Preallocated output: triangles as index triples into positions and normals, counterclockwise seen from outside
+struct TubeMeshBuffers {
+    std::span<Point3d> positions;
+    std::span<Vector3d> normals;
+    std::span<std::uint32_t> indices;
+};
+
+inline constexpr std::uint32_t max_tube_sides{1024};
+inline constexpr std::uint32_t max_tube_rings{1 << 20};
+
+// The deviation across and the deviation along the tube each get half of the tolerance.
+// Sides: the profile polygon stays within r * (1 - cos(pi / n)) <= tolerance / 2 of the circle.
+// Rings: the parameter step dt bounds the deviation of the swept surface between two rings by
+//     (|P''|max + r * w^2) * dt^2 / 8 <= tolerance / 2
+// where w is the largest rotation rate of the frame per unit of t (1 for a circle and a helix, a / b for an ellipse).
+// Both counts are capped (max_tube_sides, max_tube_rings). Empty for an unsupported curve or non-positive parameters.
+TubeMeshSize get_tube_mesh_size(const Curve& curve, const TubeParameters& parameters);
+
+TubeMeshLayout get_tube_mesh_layout(
+    std::span<const std::shared_ptr<Curve>> curves, const TubeParameters& parameters);
+
+// Writes the meshes of the curves at the layout offsets, indices refer to the whole buffer. Profiles are placed
+// in analytic frames: tangent and plane normal for a circle and an ellipse, the Frenet frame of the helix, which is
+// constant in its local basis. Curves are meshed in parallel on the executor if given.
+// False if a buffer is shorter than the layout or the vertices cannot be indexed with 32 bits.
+bool write_tube_meshes(std::span<const std::shared_ptr<Curve>> curves,
+    const TubeParameters& parameters,
+    const TubeMeshLayout& layout,
+    const TubeMeshBuffers& buffers,
+    parallel::Executor* executor = nullptr);
+
+} // namespace model3d
+} // namespace curves
+
+#endif // __TubeMesh_h__
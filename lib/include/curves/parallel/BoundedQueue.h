@@ -0,0 +1,39 @@
+#ifndef __BoundedQueue_h__
+#define __BoundedQueue_h__
+
+namespace curves {
+namespace parallel {
+
+// Blocking multi-producer multi-consumer FIFO holding at most capacity items, the back pressure between
+// two pipeline stages. After close() push fails, pop drains the remaining items and then returns nullopt.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity) : _capacity{std::max<std::size_t>(capacity, 1)} {};
+
+    BoundedQueue(const BoundedQueue& other) = delete;
+    BoundedQueue& operator=(const BoundedQueue& other) = delete;
+
+    // Waits for free space; false if the queue is closed (the value is dropped)
+    bool push(T value);
+    // Waits for an item; nullopt if the queue is closed and empty
+    std::optional<T> pop();
+
+    void close();
+    bool is_closed() const;
+
+private:
+    const std::size_t _capacity;
+    mutable std::mutex _mutex;
+    std::condition_variable _not_full;
+    std::condition_variable _not_empty;
+    std::deque<T> _items;
+    bool _closed{false};
+};
+
+} // namespace parallel
+} // namespace curves
+
+#include "BoundedQueue.hpp"
+
+#endif // __BoundedQueue_h__
@@ -0,0 +1,51 @@
+namespace curves {
+namespace parallel {
+
+template <typename T>
+bool BoundedQueue<T>::push(T value) {
+    {
+        std::unique_lock lock{_mutex};
+        _not_full.wait(lock, [this]() { return _closed || _items.size() < _capacity; });
+        if (_closed) {
+            return false;
+        }
+        _items.push_back(std::move(value));
+    }
+    _not_empty.notify_one();
+    return true;
+}
+
+template <typename T>
+std::optional<T> BoundedQueue<T>::pop() {
+    std::optional<T> value;
+    {
+        std::unique_lock lock{_mutex};
+        _not_empty.wait(lock, [this]() { return _closed || !_items.empty(); });
+        if (_items.empty()) {
+            return std::nullopt;
+        }
+        value.emplace(std::move(_items.front()));
+        _items.pop_front();
+    }
+    _not_full.notify_one();
+    return value;
+}
+
+template <typename T>
+void BoundedQueue<T>::close() {
+    {
+        std::lock_guard lock{_mutex};
+        _closed = true;
+    }
+    _not_full.notify_all();
+    _not_empty.notify_all();
+}
+
+template <typename T>
+bool BoundedQueue<T>::is_closed() const {
+    std::lock_guard lock{_mutex};
+    return _closed;
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,61 @@
+#ifndef __CurvePipeline_h__
+#define __CurvePipeline_h__
+
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/Generator.h"
+
+namespace curves {
+
+namespace model3d {
+class Curve;
+} // namespace model3d
+
+namespace parallel {
+
+using Curve_chunk = std::vector<std::shared_ptr<model3d::Curve>>;
+using Curve_predicate = std::function<bool(const model3d::Curve&)>;
+using Curve_key = std::function<double(const model3d::Curve&)>;
+
+// count random curves in chunks of chunk_size (the last one may be shorter).
+// Failed creations are passed on as nullptr, the validation stage drops them.
+Generator<Curve_chunk> generate_random_curves(std::size_t count, std::size_t chunk_size);
+
+struct PipelineOptions {
+    std::size_t queue_capacity{4}; // Chunks waiting between two stages
+    std::size_t filter_threads{0}; // Threads validating, filtering and sorting chunks; 0 means hardware cores - 2
+    std::size_t keep_smallest{0}; // Length of the sorted prefix kept by the reduction
+};
+
+struct KeyedCurve {
+    double key;
+    std::shared_ptr<model3d::Curve> curve;
+};
+
+struct PipelineResult {
+    std::size_t generated_count{}; // Including nullptr items
+    std::size_t valid_count{};
+    std::size_t selected_count{};
+    double key_sum{}; // Sum of the keys of the selected curves
+    std::vector<KeyedCurve> smallest; // At most keep_smallest selected curves with the smallest keys, ascending
+    bool cancelled{false};
+};
+
+// Streaming generate -> validate -> filter -> sort -> reduce.
+// The source is drained on its own thread, chunks are validated, filtered with select and partially sorted
+// by key (only the keep_smallest prefix) on filter_threads threads, and reduced on the calling thread, so the
+// stages overlap. The reduction adds the chunk sums and merges each sorted prefix into the running one:
+// a k-way merge spread over the chunk arrivals. Chunks are reduced in source order, the result does not depend
+// on the thread count or scheduling. A filter holds a sorted chunk back while it is queue_capacity or more
+// sequences ahead of the next chunk to reduce, so at most 2 * queue_capacity + filter_threads + 2 chunks are alive
+// at a time even when one chunk is slow.
+// An exception thrown by the source, select, key or the reduction is rethrown after all stages have stopped.
+PipelineResult run_pipeline(Generator<Curve_chunk> source,
+    const Curve_predicate& select,
+    const Curve_key& key,
+    const PipelineOptions& options = {},
+    JobControl* control = nullptr);
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __CurvePipeline_h__
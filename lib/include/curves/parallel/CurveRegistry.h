@@ -0,0 +1,138 @@
+#ifndef __CurveRegistry_h__
+#define __CurveRegistry_h__
+
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/MemoryUsage.h"
+
+namespace curves {
+namespace parallel {
+
+// 32-bit reference to a registry entry: slot index in the upper 24 bits, slot generation in the lower 8.
+// A handle of a removed curve never resolves again, even after its slot has been reused.
+class CurveHandle {
+public:
+    static constexpr std::uint32_t generation_bits{8};
+    static constexpr std::uint32_t generation_mask{(1u << generation_bits) - 1};
+    static constexpr std::uint32_t max_index{(1u << (32 - generation_bits)) - 2}; // The last index marks invalid
+
+    CurveHandle() = default;
+    CurveHandle(std::uint32_t index, std::uint32_t generation)
+        : _value{(index << generation_bits) | (generation & generation_mask)} {};
+
+    bool is_valid() const { return _value != invalid; };
+    std::uint32_t get_index() const { return _value >> generation_bits; };
+    std::uint32_t get_generation() const { return _value & generation_mask; };
+    std::uint32_t get_value() const { return _value; };
+
+    bool operator==(const CurveHandle& other) const = default;
+
+private:
+    static constexpr std::uint32_t invalid{std::numeric_limits<std::uint32_t>::max()};
+
+    std::uint32_t _value{invalid};
+};
+
+// Concurrent curve registry. insert and remove are lock-free, lookups and iteration are wait-free
+// and never block writers. A curve removed while readers may still use it is reclaimed by epochs: readers
+// hold a Guard, and a removed curve is released once every guard that could have seen it is gone.
+class CurveRegistry {
+    struct Participant;
+
+public:
+    // Read-side critical section: pointers obtained while it is alive stay valid. Guards nest, they are cheap
+    // to create, but a long-lived guard delays the release of removed curves.
+    class Guard {
+    public:
+        explicit Guard(const CurveRegistry& registry);
+        ~Guard();
+
+        Guard(const Guard& other) = delete;
+        Guard& operator=(const Guard& other) = delete;
+
+    private:
+        const CurveRegistry& _registry;
+        Participant* _participant;
+    };
+
+    using Visitor = std::function<void(CurveHandle handle, const model3d::Curve& curve)>;
+
+    static constexpr std::size_t retire_batch{64}; // Removals between two automatic reclamation passes
+
+    CurveRegistry();
+    ~CurveRegistry(); // Must not run concurrently with any other use
+
+    CurveRegistry(const CurveRegistry& other) = delete;
+    CurveRegistry& operator=(const CurveRegistry& other) = delete;
+
+    // Invalid handle for nullptr or when all 2^24 - 1 slots are in use or worn out (generations exhausted)
+    CurveHandle insert(std::shared_ptr<const model3d::Curve> curve);
+    // false if the handle is stale or already removed
+    bool remove(CurveHandle handle);
+
+    // nullptr for a stale handle; the pointer stays valid while the guard lives
+    const model3d::Curve* get(CurveHandle handle, const Guard& guard) const;
+    std::shared_ptr<const model3d::Curve> get_shared(CurveHandle handle) const;
+
+    // Visits the curves of the type present during the whole call; curves inserted or removed meanwhile
+    // may or may not be visited
+    void for_each(model3d::CurveFactory::Curve_type type, const Guard& guard, const Visitor& visitor) const;
+
+    std::size_t size() const { return _size.load(std::memory_order_relaxed); };
+
+    // Releases the removed curves no reader can see any more
+    void collect();
+
+    friend model3d::MemoryUsage model3d::memory_usage(const CurveRegistry& registry);
+
+private:
+    struct Node {
+        std::shared_ptr<const model3d::Curve> curve;
+        model3d::CurveFactory::Curve_type type;
+        std::uint64_t retire_epoch{};
+        Node* next_retired{nullptr};
+    };
+
+    struct Slot {
+        std::atomic<Node*> node{nullptr};
+        std::atomic<std::uint32_t> generation{0};
+        std::atomic<std::uint32_t> next_free{0};
+    };
+
+    struct Participant {
+        std::atomic<std::uint64_t> epoch{0}; // 0 while outside a guard
+        std::size_t depth{}; // Touched only by the owning thread
+        Participant* next{nullptr};
+    };
+
+    static constexpr std::uint32_t segment_bits{12};
+    static constexpr std::uint32_t segment_size{1u << segment_bits};
+    static constexpr std::uint32_t segment_count{(CurveHandle::max_index + 1 + segment_size - 1) / segment_size};
+
+    Slot* find_slot(std::uint32_t index) const;
+    const Node* find_node(CurveHandle handle) const;
+    std::optional<std::uint32_t> allocate_slot();
+    void release_slot(std::uint32_t index);
+
+    Participant* get_participant() const;
+    void enter(Participant* participant) const;
+    void leave(Participant* participant) const;
+    bool try_advance_epoch() const;
+    void retire(Node* node);
+
+    const std::uint64_t _id; // Distinguishes registries in the per-thread participant cache
+
+    std::array<std::atomic<Slot*>, segment_count> _segments{};
+    std::atomic<std::uint32_t> _next_slot{0};
+    std::atomic<std::uint64_t> _free_head; // Tag in the upper half against ABA, index + 1 in the lower (0: empty)
+    std::atomic<std::size_t> _size{0};
+
+    mutable std::atomic<std::uint64_t> _epoch{1};
+    mutable std::atomic<Participant*> _participants{nullptr};
+    std::atomic<Node*> _retired{nullptr};
+    std::atomic<std::size_t> _retired_since_collect{0};
+};
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __CurveRegistry_h__
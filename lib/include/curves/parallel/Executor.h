@@ -0,0 +1,96 @@
+#ifndef __Executor_h__
+#define __Executor_h__
+
+namespace curves {
+namespace parallel {
+
+// Progress reporting and cancellation of a long running bulk job
+class JobControl {
+public:
+    // Called from worker threads as (done, total), must be thread-safe
+    using Progress_callback = std::function<void(std::size_t, std::size_t)>;
+
+    JobControl() = default;
+    explicit JobControl(Progress_callback progress) : _progress{std::move(progress)} {};
+
+    void cancel() { _cancelled.store(true, std::memory_order_relaxed); };
+    bool is_cancelled() const { return _cancelled.load(std::memory_order_relaxed); };
+
+    void report_progress(std::size_t done, std::size_t total) const {
+        if (_progress) {
+            _progress(done, total);
+        }
+    };
+
+private:
+    std::atomic<bool> _cancelled{false};
+    Progress_callback _progress;
+};
+
+// Items [0, count) of a partitioned job that live on the given NUMA node
+struct Partition {
+    std::size_t node;
+    std::size_t count;
+    bool node_bound{false}; // Never stolen by workers of other nodes, unless the executor has none on this node
+};
+
+// Fixed-size thread pool running one bulk job at a time.
+// Workers are spread round-robin over the NUMA nodes (see NumaTopology) and pinned to them on multi-node machines.
+class Executor {
+public:
+    // Processes items [begin, end) on the worker with the given index
+    using Range_task = std::function<void(std::size_t begin, std::size_t end, std::size_t worker_index)>;
+    // Processes items [begin, end) of the partition on the worker with the given index
+    using Partition_task =
+        std::function<void(std::size_t partition, std::size_t begin, std::size_t end, std::size_t worker_index)>;
+
+    // thread_count == 0 means one thread per hardware core
+    explicit Executor(std::size_t thread_count = 0);
+    ~Executor();
+
+    Executor(const Executor& other) = delete;
+    Executor& operator=(const Executor& other) = delete;
+
+    std::size_t get_thread_count() const { return _threads.size(); };
+    std::size_t get_worker_node(std::size_t worker_index) const { return _worker_nodes[worker_index]; };
+
+    // Splits [0, count) into chunks of at most grain items and runs them on the worker threads,
+    // worker_index passed to the task is less than get_thread_count(). Blocks until all chunks are done.
+    // Must not be called from inside a task. When a task throws, no further chunks are started and the first
+    // exception is rethrown once every worker has left the job; the executor stays usable.
+    void parallel_for(std::size_t count, std::size_t grain, const Range_task& task);
+
+    // parallel_for over every partition: a worker first takes the chunks of the partitions on its own node
+    // and steals from the other nodes only when those are exhausted, except for node-bound partitions.
+    // Nodes are taken modulo the node count.
+    void parallel_for_partitions(std::span<const Partition> partitions, std::size_t grain, const Partition_task& task);
+
+private:
+    void worker_loop(std::size_t worker_index);
+    void run_partition(std::size_t partition, std::size_t worker_index);
+    bool can_run(const Partition& partition, std::size_t node, bool local) const;
+
+    std::vector<std::thread> _threads;
+    std::vector<std::size_t> _worker_nodes;
+    std::vector<bool> _node_has_workers; // Per node of the topology
+
+    std::mutex _submit_mutex; // Serializes parallel_for calls
+    std::mutex _mutex;
+    std::condition_variable _job_ready;
+    std::condition_variable _job_done;
+
+    const Partition_task* _task{nullptr};
+    std::span<const Partition> _partitions;
+    std::size_t _grain{};
+    std::vector<std::atomic<std::size_t>> _next_chunks; // Per partition
+    std::size_t _busy_workers{};
+    std::exception_ptr _error; // First exception thrown by a task of the current job
+    std::atomic<bool> _failed{false}; // Stops the workers from taking chunks after a task has thrown
+    std::uint64_t _job_generation{};
+    bool _stop{false};
+};
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __Executor_h__
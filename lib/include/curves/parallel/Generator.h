@@ -0,0 +1,51 @@
+#ifndef __Generator_h__
+#define __Generator_h__
+
+namespace curves {
+namespace parallel {
+
+// Lazy sequence produced by a coroutine with co_yield. The body runs only inside next(), on the calling thread,
+// so a generator can be created on one thread and drained on another (but not by two threads at once).
+template <typename T>
+class Generator {
+public:
+    struct promise_type {
+        std::optional<T> current;
+        std::exception_ptr exception;
+
+        Generator get_return_object() { return Generator{Handle::from_promise(*this)}; };
+        std::suspend_always initial_suspend() noexcept { return {}; };
+        std::suspend_always final_suspend() noexcept { return {}; };
+        std::suspend_always yield_value(T value) {
+            current = std::move(value);
+            return {};
+        };
+        void return_void() {};
+        void unhandled_exception() { exception = std::current_exception(); };
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Generator(Generator&& other) noexcept : _handle{std::exchange(other._handle, nullptr)} {};
+    Generator& operator=(Generator&& other) noexcept;
+    ~Generator();
+
+    Generator(const Generator& other) = delete;
+    Generator& operator=(const Generator& other) = delete;
+
+    // Runs the body up to the next co_yield. nullopt once the body has finished,
+    // an exception escaping the body is rethrown here.
+    std::optional<T> next();
+
+private:
+    explicit Generator(Handle handle) : _handle{handle} {};
+
+    Handle _handle;
+};
+
+} // namespace parallel
+} // namespace curves
+
+#include "Generator.hpp"
+
+#endif // __Generator_h__
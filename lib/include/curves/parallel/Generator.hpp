@@ -0,0 +1,43 @@
+namespace curves {
+namespace parallel {
+
+template <typename T>
+Generator<T>& Generator<T>::operator=(Generator&& other) noexcept {
+    if (this != &other) {
+        if (_handle) {
+            _handle.destroy();
+        }
+        _handle = std::exchange(other._handle, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+Generator<T>::~Generator() {
+    if (_handle) {
+        _handle.destroy();
+    }
+}
+
+template <typename T>
+std::optional<T> Generator<T>::next() {
+    if (!_handle || _handle.done()) {
+        return std::nullopt;
+    }
+
+    _handle.resume();
+    auto& promise{_handle.promise()};
+    if (promise.exception) {
+        std::rethrow_exception(std::exchange(promise.exception, nullptr));
+    }
+    if (_handle.done()) {
+        return std::nullopt;
+    }
+
+    std::optional<T> value{std::move(promise.current)};
+    promise.current.reset();
+    return value;
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,40 @@
+#ifndef __NumaTopology_h__
+#define __NumaTopology_h__
+
+namespace curves {
+namespace parallel {
+
+// NUMA nodes and their CPUs as reported by /sys/devices/system/node. Where that is not available
+// (not Linux, no NUMA support in the kernel) the machine is described as a single node without CPU list,
+// and the placement functions below do nothing.
+class NumaTopology {
+public:
+    // Detected once, on first use
+    static const NumaTopology& get();
+
+    std::size_t get_node_count() const { return _cpus.size(); };
+    bool is_numa() const { return _cpus.size() > 1; };
+    std::span<const std::size_t> get_cpus(std::size_t node) const { return _cpus[node % _cpus.size()]; };
+
+    // Restricts the calling thread to the CPUs of the node, false if not possible
+    bool pin_thread(std::size_t node) const;
+
+    // Makes the node the preferred location of the pages of [data, data + size) (mbind, MPOL_PREFERRED).
+    // Pages already touched elsewhere are migrated if the kernel can (MPOL_MF_MOVE), pages shared with other
+    // data may end up on the node as well. False if not possible.
+    bool prefer_node(const void* data, std::size_t size, std::size_t node) const;
+
+    // Parses a kernel CPU or node list such as "0-3,8,10-11"
+    static std::vector<std::size_t> parse_list(const std::string& list);
+
+private:
+    NumaTopology();
+
+    std::vector<std::vector<std::size_t>> _cpus; // Per node, never empty
+    std::vector<std::size_t> _node_ids; // Kernel ids of the nodes, they may have gaps
+};
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __NumaTopology_h__
@@ -0,0 +1,22 @@
+#ifndef __ParallelSort_h__
+#define __ParallelSort_h__
+
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace parallel {
+
+inline constexpr std::size_t sort_grain{1 << 14};
+
+// Sorts the items by operator<. With an executor and more than sort_grain items, runs of sort_grain items are sorted
+// on its workers and merged pairwise in parallel rounds. Not stable: give the items a unique order (e.g. an index
+// as the last member) when the result has to be deterministic.
+template <typename T>
+void parallel_sort(std::vector<T>& items, Executor* executor = nullptr);
+
+} // namespace parallel
+} // namespace curves
+
+#include "curves/parallel/ParallelSort.hpp"
+
+#endif // __ParallelSort_h__
@@ -0,0 +1,29 @@
+namespace curves {
+namespace parallel {
+
+template <typename T>
+void parallel_sort(std::vector<T>& items, Executor* executor) {
+    if (!executor || items.size() <= sort_grain) {
+        std::sort(items.begin(), items.end());
+        return;
+    }
+
+    // Runs sorted in parallel, then merged pairwise in parallel rounds
+    executor->parallel_for(items.size(), sort_grain, [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::sort(items.begin() + begin, items.begin() + end);
+    });
+    for (std::size_t width{sort_grain}; width < items.size(); width *= 2) {
+        const std::size_t pair_count{(items.size() + 2 * width - 1) / (2 * width)};
+        executor->parallel_for(pair_count, 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t pair{begin}; pair < end; ++pair) {
+                const std::size_t first{pair * 2 * width};
+                const std::size_t middle{std::min(first + width, items.size())};
+                const std::size_t last{std::min(first + 2 * width, items.size())};
+                std::inplace_merge(items.begin() + first, items.begin() + middle, items.begin() + last);
+            }
+        });
+    }
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,44 @@
+#ifndef __PartitionedCurveStore_h__
+#define __PartitionedCurveStore_h__
+
+#include "curves/model3d/CurveStore.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace parallel {
+
+// Curve population split into contiguous ranges, one model3d::CurveStore per NUMA node. Every store is built
+// by an executor worker of its node (a node-bound partition), so its pages are first-touched there; only if the
+// executor has no worker on a node is its store built elsewhere. The buffers of every store are then given their
+// node as the preferred location, which also migrates pages touched on another node. Passes over the curves
+// should use get_partitions() with Executor::parallel_for_partitions or the partitioned parallel::sum, which keep
+// the workers on their local partitions before stealing.
+class PartitionedCurveStore {
+public:
+    // nullopt if a curve is not a Circle, Ellipse or Helix
+    static std::optional<PartitionedCurveStore> build(
+        std::span<const std::shared_ptr<model3d::Curve>> curves, Executor& executor);
+
+    std::size_t size() const { return _size; };
+    std::size_t get_partition_count() const { return _stores.size(); };
+    const model3d::CurveStore& get_partition(std::size_t partition) const { return _stores[partition]; };
+
+    // Partition p holds the input curves [get_offset(p), get_offset(p) + get_partition(p).size())
+    std::size_t get_offset(std::size_t partition) const { return _offsets[partition]; };
+
+    // One item per curve, to be used with Executor::parallel_for_partitions
+    std::span<const Partition> get_partitions() const { return _partitions; };
+
+    friend model3d::MemoryUsage model3d::memory_usage(const PartitionedCurveStore& store);
+
+private:
+    std::vector<model3d::CurveStore> _stores;
+    std::vector<std::size_t> _offsets;
+    std::vector<Partition> _partitions;
+    std::size_t _size{};
+};
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __PartitionedCurveStore_h__
@@ -0,0 +1,69 @@
+#ifndef __Reduction_h__
+#define __Reduction_h__
+
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace parallel {
+
+// Neumaier compensated accumulator: the rounding error of every addition is collected separately, so the result
+// stays accurate when the summands differ by many orders of magnitude (radii from 1e-5 to 1e6).
+class CompensatedSum {
+public:
+    void add(double value) {
+        const double sum{_sum + value};
+        // Branch-free selection keeps the lane loops vectorizable
+        const bool sum_is_larger{std::abs(_sum) >= std::abs(value)};
+        const double larger{sum_is_larger ? _sum : value};
+        const double smaller{sum_is_larger ? value : _sum};
+        _compensation += (larger - sum) + smaller;
+        _sum = sum;
+    };
+
+    CompensatedSum& operator+=(const CompensatedSum& other) {
+        add(other._sum);
+        _compensation += other._compensation;
+        return *this;
+    };
+
+    double get_value() const { return _sum + _compensation; };
+
+private:
+    double _sum{};
+    double _compensation{};
+};
+
+// Reductions are split into blocks of reduction_block_size items. Inside a block item i goes to accumulator
+// i % reduction_lanes, the lanes are merged in order, and the block sums are combined by a pairwise tree over
+// the block index. The shape of the computation depends only on the number of items, so the result is bitwise
+// the same with or without an executor and for any thread count.
+inline constexpr std::size_t reduction_block_size{4096};
+inline constexpr std::size_t reduction_lanes{4};
+
+// Pairwise combination of the block sums in index order
+double combine_block_sums(std::span<const CompensatedSum> block_sums);
+
+// Sum of value(i) over [0, count) as one block, count <= reduction_block_size
+template <typename Value>
+CompensatedSum sum_block(std::size_t count, Value value);
+
+double sum(std::span<const double> values, Executor* executor = nullptr);
+
+// Sum of projection(item) over the items, e.g. the radii of circles. With an executor the blocks are summed on
+// its workers.
+template <typename T, typename Projection>
+double sum(std::span<const T> items, Projection projection, Executor* executor = nullptr);
+
+// Sum of value(partition, i) over the items i of every partition, e.g. of a PartitionedCurveStore. The blocks are
+// formed per partition and their sums combined in partition order; with an executor they are summed through
+// parallel_for_partitions, so workers stay on the partitions of their node first. The result depends on the
+// partition sizes but not on the executor.
+template <typename Value>
+double sum(std::span<const Partition> partitions, Value value, Executor* executor = nullptr);
+
+} // namespace parallel
+} // namespace curves
+
+#include "curves/parallel/Reduction.hpp"
+
+#endif // __Reduction_h__
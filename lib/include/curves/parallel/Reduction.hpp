@@ -0,0 +1,81 @@
+namespace curves {
+namespace parallel {
+
+template <typename Value>
+CompensatedSum sum_block(std::size_t count, Value value) {
+    std::array<CompensatedSum, reduction_lanes> lanes{};
+    const std::size_t full_size{count - count % reduction_lanes};
+    for (std::size_t i{}; i < full_size; i += reduction_lanes) {
+        for (std::size_t lane{}; lane < reduction_lanes; ++lane) {
+            lanes[lane].add(static_cast<double>(value(i + lane)));
+        }
+    }
+    for (std::size_t i{full_size}; i < count; ++i) {
+        lanes[i - full_size].add(static_cast<double>(value(i)));
+    }
+
+    for (std::size_t lane{1}; lane < reduction_lanes; ++lane) {
+        lanes[0] += lanes[lane];
+    }
+    return lanes[0];
+}
+
+template <typename T, typename Projection>
+double sum(std::span<const T> items, Projection projection, Executor* executor) {
+    const std::size_t block_count{(items.size() + reduction_block_size - 1) / reduction_block_size};
+    std::vector<CompensatedSum> block_sums(block_count);
+
+    auto sum_blocks = [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t block{begin}; block < end; ++block) {
+            const std::size_t block_begin{block * reduction_block_size};
+            const auto block_items{
+                items.subspan(block_begin, std::min(reduction_block_size, items.size() - block_begin))};
+            block_sums[block] =
+                sum_block(block_items.size(), [&](std::size_t i) { return projection(block_items[i]); });
+        }
+    };
+
+    if (executor && block_count > 1) {
+        executor->parallel_for(block_count, 1, sum_blocks);
+    } else {
+        sum_blocks(0, block_count, 0);
+    }
+
+    return combine_block_sums(block_sums);
+}
+
+template <typename Value>
+double sum(std::span<const Partition> partitions, Value value, Executor* executor) {
+    // Blocks of every partition, placed on the node of the partition
+    std::vector<Partition> block_partitions;
+    std::vector<std::size_t> block_offsets{0};
+    for (const auto& partition : partitions) {
+        const std::size_t block_count{(partition.count + reduction_block_size - 1) / reduction_block_size};
+        block_partitions.push_back({partition.node, block_count});
+        block_offsets.push_back(block_offsets.back() + block_count);
+    }
+    std::vector<CompensatedSum> block_sums(block_offsets.back());
+
+    auto sum_blocks = [&](std::size_t partition, std::size_t begin, std::size_t end, std::size_t) {
+        const std::size_t count{partitions[partition].count};
+        for (std::size_t block{begin}; block < end; ++block) {
+            const std::size_t block_begin{block * reduction_block_size};
+            block_sums[block_offsets[partition] + block] =
+                sum_block(std::min(reduction_block_size, count - block_begin),
+                    [&](std::size_t i) { return value(partition, block_begin + i); });
+        }
+    };
+
+    if (executor && block_sums.size() > 1) {
+        executor->parallel_for_partitions(block_partitions, 1, sum_blocks);
+    } else {
+        for (std::size_t partition{}; partition < block_partitions.size(); ++partition) {
+            sum_blocks(partition, 0, block_partitions[partition].count, 0);
+        }
+    }
+
+    return combine_block_sums(block_sums);
+}
+
+} // namespace parallel
+} // namespace curves
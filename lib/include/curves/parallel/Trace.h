@@ -0,0 +1,88 @@
+#ifndef __Trace_h__
+#define __Trace_h__
+
+namespace curves {
+namespace parallel {
+
+// A finished span, times in nanoseconds since the tracer was created
+struct TraceEvent {
+    const char* name; // String literal, only the pointer is stored
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint32_t thread_id; // Sequential id of the recording thread, 0 for the first one
+};
+
+// Collects trace spans into a ring buffer per thread and exports them as Chrome Trace Event JSON
+// (chrome://tracing, ui.perfetto.dev). Disabled by default: a span then costs one relaxed atomic load.
+// The buffers outlive their threads and are reused by new threads, so spans of finished workers are kept.
+class Tracer {
+public:
+    static constexpr std::size_t default_capacity{1 << 14}; // Events per thread
+
+    static Tracer& get();
+
+    static bool is_enabled() { return _enabled.load(std::memory_order_relaxed); };
+    // Nanoseconds since the tracer was created, steady clock
+    static std::uint64_t now();
+
+    void enable() { _enabled.store(true, std::memory_order_relaxed); };
+    void disable() { _enabled.store(false, std::memory_order_relaxed); };
+
+    // Events kept per thread, the oldest are overwritten when a buffer is full. Clears the buffers.
+    void set_capacity(std::size_t capacity);
+    std::size_t get_capacity() const;
+    void clear();
+
+    void record(const char* name, std::uint64_t start, std::uint64_t end);
+
+    // Events of all threads ordered by start time. Spans recorded meanwhile may or may not be included.
+    std::vector<TraceEvent> get_events() const;
+    // Events overwritten since the last clear
+    std::uint64_t get_dropped_count() const;
+
+    void write_chrome_trace(std::ostream& stream) const;
+    bool write_chrome_trace(const std::string& path) const;
+
+private:
+    struct ThreadBuffer;
+    class BufferLease;
+
+    Tracer();
+    ~Tracer();
+
+    ThreadBuffer& acquire_buffer();
+    void release_buffer(ThreadBuffer& buffer);
+
+    static std::atomic<bool> _enabled;
+
+    mutable std::mutex _mutex; // Guards the buffer lists and the capacity
+    std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+    std::vector<ThreadBuffer*> _free_buffers; // Of finished threads
+    std::size_t _capacity{default_capacity};
+    std::uint32_t _next_thread_id{};
+};
+
+// Records the lifetime of the scope as a span if tracing is enabled when it starts:
+//     TraceSpan span{"CurveFactory::create_circles"};
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name)
+        : _name{Tracer::is_enabled() ? name : nullptr}, _start{_name ? Tracer::now() : 0} {};
+    ~TraceSpan() {
+        if (_name) {
+            Tracer::get().record(_name, _start, Tracer::now());
+        }
+    };
+
+    TraceSpan(const TraceSpan& other) = delete;
+    TraceSpan& operator=(const TraceSpan& other) = delete;
+
+private:
+    const char* _name;
+    std::uint64_t _start;
+};
+
+} // namespace parallel
+} // namespace curves
+
+#endif // __Trace_h__
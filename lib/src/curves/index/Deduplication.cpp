@@ -0,0 +1,371 @@
+#include "curves/index/Deduplication.h"
+
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/ParallelSort.h"
+
+namespace curves {
+namespace index {
+
+namespace {
+
+using model3d::CurveFactory;
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+constexpr std::size_t grain{1 << 12};
+constexpr std::uint32_t no_index{std::numeric_limits<std::uint32_t>::max()};
+constexpr std::size_t key_dimensions{7}; // Position, size and axis
+constexpr std::size_t type_count{static_cast<std::size_t>(CurveFactory::Curve_type::size)};
+
+// Parameterization independent description used for hashing
+struct CanonicalForm {
+    CurveFactory::Curve_type type;
+    // Center (foot of the axis for a helix), largest radius and the axis with the sign that makes its first
+    // component of magnitude >= 0.5 positive
+    std::array<double, key_dimensions> key;
+    double position_reach; // Largest difference of the position keys of two equivalent curves
+};
+
+// Sign of the axis that makes the key independent of its orientation
+Vector3d get_canonical_axis(const Vector3d& axis) {
+    for (std::size_t i{}; i < 3; ++i) {
+        if (std::abs(axis.data()[i]) >= 0.5) {
+            return axis.data()[i] < 0.0 ? axis * -1.0 : axis;
+        }
+    }
+    return axis; // Not a unit vector
+}
+
+CanonicalForm make_form(CurveFactory::Curve_type type,
+    const Vector3d& position,
+    double radius,
+    const Vector3d& axis,
+    double position_reach) {
+    const auto canonical_axis{get_canonical_axis(axis)};
+    return CanonicalForm{type,
+        {position.x(),
+            position.y(),
+            position.z(),
+            radius,
+            canonical_axis.x(),
+            canonical_axis.y(),
+            canonical_axis.z()},
+        position_reach};
+}
+
+std::optional<CanonicalForm> get_canonical_form(const model3d::Curve& curve, double precision) {
+    if (const auto* circle{dynamic_cast<const model3d::Circle*>(&curve)}) {
+        return make_form(CurveFactory::Curve_type::circle,
+            circle->get_center() - Point3d{0.0, 0.0, 0.0},
+            circle->get_radius(),
+            circle->get_axis(),
+            precision);
+    }
+    if (const auto* ellipse{dynamic_cast<const model3d::Ellipse*>(&curve)}) {
+        return make_form(CurveFactory::Curve_type::ellipse,
+            ellipse->get_center() - Point3d{0.0, 0.0, 0.0},
+            std::max(ellipse->get_radius_major(), ellipse->get_radius_minor()),
+            ellipse->get_axis(),
+            precision);
+    }
+    if (const auto* helix{dynamic_cast<const model3d::Helix*>(&curve)}) {
+        // The center moves along the axis with the phase, the point of the axis line closest to the origin does not.
+        // It does move with the tilt of the axis though: equivalent axis lines are within the precision of each
+        // other at the center and their directions differ by up to the precision, so the feet differ by up to
+        // precision * (1 + 2 * |center|).
+        const auto& axis{helix->get_axis()};
+        const auto center{helix->get_center() - Point3d{0.0, 0.0, 0.0}};
+        const auto foot{center - axis * math::scalar_product(center, axis)};
+        return make_form(CurveFactory::Curve_type::helix,
+            foot,
+            helix->get_radius(),
+            axis,
+            precision * (2.0 + 2.0 * center.get_magnitude()));
+    }
+    return std::nullopt;
+}
+
+// Cells are four times the reach of their dimension: a key is compared with the keys in its own cell and, when it
+// is within the reach of a border, in the neighbour across it. Only the position cells depend on the type.
+struct CellGrid {
+    std::array<std::array<double, key_dimensions>, type_count> cell_sizes;
+    double axis_reach;
+};
+
+CellGrid make_cell_grid(std::span<const std::optional<CanonicalForm>> forms, double precision) {
+    // Parallel unit axes differ by at most asin(precision) per component, the sign choice is checked separately
+    CellGrid grid{{}, 2.0 * precision};
+    std::array<double, type_count> position_reach{};
+    position_reach.fill(precision);
+    for (const auto& form : forms) {
+        if (form) {
+            auto& reach{position_reach[static_cast<std::size_t>(form->type)]};
+            reach = std::max(reach, form->position_reach);
+        }
+    }
+
+    for (std::size_t type{}; type < type_count; ++type) {
+        auto& sizes{grid.cell_sizes[type]};
+        for (std::size_t i{}; i < 3; ++i) {
+            sizes[i] = 4.0 * position_reach[type];
+            sizes[i + 4] = 4.0 * grid.axis_reach;
+        }
+        sizes[3] = 4.0 * precision;
+    }
+    return grid;
+}
+
+struct CellEntry {
+    std::uint64_t hash;
+    std::uint32_t index;
+
+    auto operator<=>(const CellEntry& other) const = default;
+};
+
+std::uint64_t get_cell_hash(CurveFactory::Curve_type type, const std::array<std::int64_t, key_dimensions>& cell) {
+    std::uint64_t hash{static_cast<std::uint64_t>(type) + 1};
+    for (const auto coordinate : cell) {
+        hash = (hash ^ static_cast<std::uint64_t>(coordinate)) * 0x100000001B3ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+// Cells are centered on the multiples of their size, so that round values (a center at the origin, a unit radius,
+// an axis along a coordinate) are far from a border and need no neighbour
+double get_cell_index(double key, double cell_size) {
+    return std::floor(key / cell_size + 0.5);
+}
+
+std::uint64_t get_own_hash(const CanonicalForm& form, const CellGrid& grid) {
+    const auto& sizes{grid.cell_sizes[static_cast<std::size_t>(form.type)]};
+    std::array<std::int64_t, key_dimensions> cell{};
+    for (std::size_t i{}; i < key_dimensions; ++i) {
+        cell[i] = static_cast<std::int64_t>(get_cell_index(form.key[i], sizes[i]));
+    }
+    return get_cell_hash(form.type, cell);
+}
+
+// Hashes of the cells that can hold the key of an equivalent curve: per dimension the own cell and the neighbour
+// across a border within the reach. An equivalent curve may have picked the other sign of the axis when a component
+// is near the 0.5 threshold of get_canonical_axis, the cells around the flipped axis are added then.
+void get_probe_hashes(const CanonicalForm& form, const CellGrid& grid, std::vector<std::uint64_t>& hashes) {
+    const auto& sizes{grid.cell_sizes[static_cast<std::size_t>(form.type)]};
+    hashes.clear();
+
+    const auto add_cells = [&](const std::array<double, key_dimensions>& key) {
+        std::array<std::int64_t, key_dimensions> cell{};
+        std::array<std::int64_t, key_dimensions> neighbour{};
+        std::size_t neighbour_mask{};
+        for (std::size_t i{}; i < key_dimensions; ++i) {
+            const double reach{sizes[i] / 4.0};
+            const double floor{get_cell_index(key[i], sizes[i])};
+            const double offset{key[i] - (floor - 0.5) * sizes[i]};
+            cell[i] = static_cast<std::int64_t>(floor);
+            if (offset <= reach || offset >= sizes[i] - reach) {
+                neighbour[i] = offset <= reach ? cell[i] - 1 : cell[i] + 1;
+                neighbour_mask |= std::size_t{1} << i;
+            }
+        }
+
+        // Every subset of the dimensions near a border
+        for (std::size_t probe{neighbour_mask};; probe = (probe - 1) & neighbour_mask) {
+            auto probed{cell};
+            for (std::size_t i{}; i < key_dimensions; ++i) {
+                if (probe & (std::size_t{1} << i)) {
+                    probed[i] = neighbour[i];
+                }
+            }
+            hashes.push_back(get_cell_hash(form.type, probed));
+            if (probe == 0) {
+                break;
+            }
+        }
+    };
+
+    add_cells(form.key);
+    if (std::any_of(form.key.begin() + 4, form.key.end(), [&](double component) {
+            return std::abs(std::abs(component) - 0.5) <= grid.axis_reach;
+        })) {
+        auto flipped{form.key};
+        for (std::size_t i{4}; i < key_dimensions; ++i) {
+            flipped[i] = -flipped[i];
+        }
+        add_cells(flipped);
+    }
+
+    // Hash collisions and the two signs may repeat a cell, it is walked once
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+template <typename Task>
+void for_ranges(std::size_t count, parallel::Executor* executor, const Task& task) {
+    if (executor && count > grain) {
+        executor->parallel_for(
+            count, grain, [&](std::size_t begin, std::size_t end, std::size_t) { task(begin, end); });
+    } else {
+        task(0, count);
+    }
+}
+
+bool are_parallel(const Vector3d& first, const Vector3d& second, double precision) {
+    return math::cross_product(first, second).get_sqr_magnitude() <= precision * precision;
+}
+
+bool are_equivalent(const model3d::Circle& first, const model3d::Circle& second, double precision) {
+    return math::equal(first.get_center(), second.get_center(), precision)
+        && std::abs(first.get_radius() - second.get_radius()) <= precision
+        && are_parallel(first.get_axis(), second.get_axis(), precision);
+}
+
+bool are_equivalent(const model3d::Ellipse& first, const model3d::Ellipse& second, double precision) {
+    // The major axis is the larger radius, its direction matters up to the sign (phase shift by pi)
+    const auto get_major = [](const model3d::Ellipse& ellipse) {
+        return ellipse.get_radius_major() >= ellipse.get_radius_minor() ? ellipse.get_axis_x() : ellipse.get_axis_y();
+    };
+    const double first_major{std::max(first.get_radius_major(), first.get_radius_minor())};
+    const double first_minor{std::min(first.get_radius_major(), first.get_radius_minor())};
+    const double second_major{std::max(second.get_radius_major(), second.get_radius_minor())};
+    const double second_minor{std::min(second.get_radius_major(), second.get_radius_minor())};
+
+    if (!math::equal(first.get_center(), second.get_center(), precision)
+        || std::abs(first_major - second_major) > precision || std::abs(first_minor - second_minor) > precision
+        || !are_parallel(first.get_axis(), second.get_axis(), precision)) {
+        return false;
+    }
+    // A nearly round ellipse has no distinguished direction
+    return first_major - first_minor <= precision || are_parallel(get_major(first), get_major(second), precision);
+}
+
+bool are_equivalent(const model3d::Helix& first, const model3d::Helix& second, double precision) {
+    // Reversing the axis of a helix reverses its parameter but keeps its points, so with the same radius, step and
+    // axis line the helices coincide when the start point of the second lies on the first
+    if (std::abs(first.get_radius() - second.get_radius()) > precision
+        || std::abs(first.get_step() - second.get_step()) > precision
+        || !are_parallel(first.get_axis(), second.get_axis(), precision)) {
+        return false;
+    }
+
+    const auto offset{second.get_center() - first.get_center()};
+    const double height{math::scalar_product(offset, first.get_axis())};
+    if ((offset - first.get_axis() * height).get_sqr_magnitude() > precision * precision) {
+        return false;
+    }
+
+    // Comparing points at the same parameter would amplify an axial error by the turn length over the step, the
+    // distance to the curve is the axial mismatch at the start angle projected on the normal of the helix
+    const auto& start{second.get_axis_x()};
+    const double angle{
+        std::atan2(math::scalar_product(start, first.get_axis_y()), math::scalar_product(start, first.get_axis_x()))};
+    const double step{first.get_step()};
+    const double mismatch{height - step * angle / math::two_pi};
+    const double axial{mismatch - step * std::round(mismatch / step)};
+    const double turn{math::two_pi * first.get_radius()};
+    return std::abs(axial) * turn / std::hypot(turn, step) <= precision;
+}
+
+} // namespace
+
+bool are_equivalent(const model3d::Curve& first, const model3d::Curve& second, double precision) {
+    if (const auto* first_circle{dynamic_cast<const model3d::Circle*>(&first)}) {
+        const auto* second_circle{dynamic_cast<const model3d::Circle*>(&second)};
+        return second_circle && are_equivalent(*first_circle, *second_circle, precision);
+    }
+    if (const auto* first_ellipse{dynamic_cast<const model3d::Ellipse*>(&first)}) {
+        const auto* second_ellipse{dynamic_cast<const model3d::Ellipse*>(&second)};
+        return second_ellipse && are_equivalent(*first_ellipse, *second_ellipse, precision);
+    }
+    if (const auto* first_helix{dynamic_cast<const model3d::Helix*>(&first)}) {
+        const auto* second_helix{dynamic_cast<const model3d::Helix*>(&second)};
+        return second_helix && are_equivalent(*first_helix, *second_helix, precision);
+    }
+    return &first == &second;
+}
+
+DeduplicationResult deduplicate(
+    std::span<const std::shared_ptr<model3d::Curve>> curves, double precision, parallel::Executor* executor) {
+    const std::size_t count{curves.size()};
+    const double key_precision{std::max(precision, std::numeric_limits<double>::min())}; // Nonzero cells
+
+    std::vector<std::optional<CanonicalForm>> forms(count);
+    for_ranges(count, executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            forms[i] = get_canonical_form(*curves[i], key_precision);
+        }
+    });
+    const auto grid{make_cell_grid(forms, key_precision)};
+
+    std::vector<CellEntry> cells(count);
+    for_ranges(count, executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            // Curves of other types only match themselves, they get no cell
+            cells[i] = {forms[i] ? get_own_hash(*forms[i], grid) : 0, static_cast<std::uint32_t>(i)};
+        }
+    });
+    parallel::parallel_sort(cells, executor);
+
+    // Earlier curves equivalent to curve i, in ascending order, limited to those below before
+    const auto find_earlier = [&](std::size_t i, std::uint32_t before, const auto& accept) {
+        std::uint32_t result{no_index};
+        if (!forms[i]) {
+            return result;
+        }
+        thread_local std::vector<std::uint64_t> hashes{};
+        get_probe_hashes(*forms[i], grid, hashes);
+        for (const auto hash : hashes) {
+            const auto first{std::lower_bound(cells.begin(), cells.end(), CellEntry{hash, 0})};
+            for (auto it{first}; it != cells.end() && it->hash == hash; ++it) {
+                const std::uint32_t candidate{it->index};
+                if (candidate >= std::min(result, before)) {
+                    break; // Entries of a cell are ordered by index
+                }
+                if (accept(candidate) && are_equivalent(*curves[candidate], *curves[i], precision)) {
+                    result = candidate;
+                    break;
+                }
+            }
+        }
+        return result;
+    };
+
+    // The comparisons run in parallel, the sequential pass only follows the rare chains of curves that are
+    // equivalent to a dropped curve but not to the curve that one was dropped for
+    std::vector<std::uint32_t> first_equivalent(count);
+    for_ranges(count, executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            first_equivalent[i] =
+                find_earlier(i, static_cast<std::uint32_t>(i), [](std::uint32_t) { return true; });
+        }
+    });
+
+    DeduplicationResult result;
+    result.remap.resize(count);
+    std::vector<std::uint32_t> position(count, no_index); // In result.curves, for kept curves
+    for (std::size_t i{}; i < count; ++i) {
+        std::uint32_t representative{first_equivalent[i]};
+        if (representative != no_index && position[representative] == no_index) {
+            representative = find_earlier(i, static_cast<std::uint32_t>(i), [&](std::uint32_t candidate) {
+                return position[candidate] != no_index;
+            });
+        }
+
+        if (representative == no_index) {
+            position[i] = static_cast<std::uint32_t>(result.curves.size());
+            result.curves.push_back(curves[i]);
+            result.source.push_back(static_cast<std::uint32_t>(i));
+            result.remap[i] = position[i];
+        } else {
+            result.remap[i] = position[representative];
+        }
+    }
+    return result;
+}
+
+} // namespace index
+} // namespace curves
@@ -0,0 +1,336 @@
+#include "curves/index/RadiusBTree.h"
+
+namespace curves {
+namespace index {
+
+namespace {
+
+constexpr std::size_t min_fill{RadiusBTree::node_capacity / 4};
+constexpr std::size_t build_fill{RadiusBTree::node_capacity * 3 / 4}; // Room for inserts after a bulk build
+
+} // namespace
+
+struct RadiusBTree::Node {
+    bool leaf{true};
+    std::vector<RadiusItem> items; // Leaf: the items; inner: the smallest item under each child
+    std::vector<std::unique_ptr<Node>> children; // Inner only
+    std::vector<std::size_t> counts; // Inner only: items under each child
+    std::size_t total{}; // Items under the node
+    Node* previous{nullptr}; // Leaf only
+    Node* next{nullptr}; // Leaf only
+
+    std::size_t get_size() const { return leaf ? items.size() : children.size(); };
+
+    // Child that may contain the item
+    std::size_t route(const RadiusItem& item) const {
+        const auto after{std::upper_bound(items.begin(), items.end(), item)};
+        return after == items.begin() ? 0 : static_cast<std::size_t>(after - items.begin()) - 1;
+    };
+
+    // Last child with a smallest item below the key: every child before it holds only items below the key
+    std::size_t route_below(const RadiusItem& key) const {
+        const auto after{std::lower_bound(items.begin(), items.end(), key)};
+        return after == items.begin() ? 0 : static_cast<std::size_t>(after - items.begin()) - 1;
+    };
+
+    // Returns the new right sibling if the node had to be split
+    std::unique_ptr<Node> insert(const RadiusItem& item);
+    bool erase(const RadiusItem& item);
+
+    std::unique_ptr<Node> split();
+    void remove_child(std::size_t child);
+    void merge_child(std::size_t child);
+};
+
+std::unique_ptr<RadiusBTree::Node> RadiusBTree::Node::insert(const RadiusItem& item) {
+    ++total;
+    if (leaf) {
+        items.insert(std::upper_bound(items.begin(), items.end(), item), item);
+    } else {
+        const auto child{route(item)};
+        auto sibling{children[child]->insert(item)};
+        ++counts[child];
+        items[child] = children[child]->items.front();
+        if (sibling) {
+            counts[child] = children[child]->total;
+            items.insert(items.begin() + static_cast<std::ptrdiff_t>(child) + 1, sibling->items.front());
+            counts.insert(counts.begin() + static_cast<std::ptrdiff_t>(child) + 1, sibling->total);
+            children.insert(children.begin() + static_cast<std::ptrdiff_t>(child) + 1, std::move(sibling));
+        }
+    }
+    return get_size() > node_capacity ? split() : nullptr;
+}
+
+bool RadiusBTree::Node::erase(const RadiusItem& item) {
+    if (leaf) {
+        const auto found{std::lower_bound(items.begin(), items.end(), item)};
+        if (found == items.end() || *found != item) {
+            return false;
+        }
+        items.erase(found);
+        --total;
+        return true;
+    }
+
+    const auto child{route(item)};
+    if (!children[child]->erase(item)) {
+        return false;
+    }
+    --total;
+    --counts[child];
+    if (children[child]->get_size() == 0) {
+        remove_child(child);
+    } else {
+        items[child] = children[child]->items.front();
+        if (children[child]->get_size() < min_fill) {
+            merge_child(child);
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<RadiusBTree::Node> RadiusBTree::Node::split() {
+    const auto half{static_cast<std::ptrdiff_t>(get_size() / 2)};
+    auto sibling{std::make_unique<Node>()};
+    sibling->leaf = leaf;
+    sibling->items.assign(items.begin() + half, items.end());
+    items.resize(static_cast<std::size_t>(half));
+
+    if (leaf) {
+        sibling->total = sibling->items.size();
+        sibling->next = next;
+        sibling->previous = this;
+        if (next) {
+            next->previous = sibling.get();
+        }
+        next = sibling.get();
+    } else {
+        sibling->children.assign(
+            std::make_move_iterator(children.begin() + half), std::make_move_iterator(children.end()));
+        sibling->counts.assign(counts.begin() + half, counts.end());
+        children.resize(static_cast<std::size_t>(half));
+        counts.resize(static_cast<std::size_t>(half));
+        sibling->total = std::accumulate(sibling->counts.begin(), sibling->counts.end(), std::size_t{});
+    }
+    total -= sibling->total;
+    return sibling;
+}
+
+void RadiusBTree::Node::remove_child(std::size_t child) {
+    auto& removed{*children[child]};
+    if (removed.leaf) {
+        if (removed.previous) {
+            removed.previous->next = removed.next;
+        }
+        if (removed.next) {
+            removed.next->previous = removed.previous;
+        }
+    }
+    children.erase(children.begin() + static_cast<std::ptrdiff_t>(child));
+    items.erase(items.begin() + static_cast<std::ptrdiff_t>(child));
+    counts.erase(counts.begin() + static_cast<std::ptrdiff_t>(child));
+}
+
+void RadiusBTree::Node::merge_child(std::size_t child) {
+    if (children.size() < 2) {
+        return;
+    }
+    const std::size_t left_index{child + 1 < children.size() ? child : child - 1};
+    auto& left{*children[left_index]};
+    auto& right{*children[left_index + 1]};
+    if (left.get_size() + right.get_size() > node_capacity) {
+        return;
+    }
+
+    left.items.insert(left.items.end(), right.items.begin(), right.items.end());
+    if (left.leaf) {
+        left.next = right.next;
+        if (right.next) {
+            right.next->previous = &left;
+        }
+    } else {
+        left.children.insert(left.children.end(),
+            std::make_move_iterator(right.children.begin()),
+            std::make_move_iterator(right.children.end()));
+        left.counts.insert(left.counts.end(), right.counts.begin(), right.counts.end());
+    }
+    left.total += right.total;
+    counts[left_index] = left.total;
+
+    const auto right_position{static_cast<std::ptrdiff_t>(left_index) + 1};
+    children.erase(children.begin() + right_position);
+    items.erase(items.begin() + right_position);
+    counts.erase(counts.begin() + right_position);
+}
+
+RadiusBTree::RadiusBTree() : _root{std::make_unique<Node>()} {};
+
+RadiusBTree::~RadiusBTree() = default;
+
+RadiusBTree::RadiusBTree(RadiusBTree&& other) noexcept = default;
+
+RadiusBTree& RadiusBTree::operator=(RadiusBTree&& other) noexcept = default;
+
+RadiusBTree RadiusBTree::build(std::span<const double> radii, parallel::Executor* executor) {
+    const auto items{get_sorted_items(radii, executor)};
+
+    std::vector<std::unique_ptr<Node>> level;
+    for (std::size_t begin{}; begin < items.size(); begin += build_fill) {
+        auto leaf{std::make_unique<Node>()};
+        leaf->items.assign(items.begin() + static_cast<std::ptrdiff_t>(begin),
+            items.begin() + static_cast<std::ptrdiff_t>(std::min(begin + build_fill, items.size())));
+        leaf->total = leaf->items.size();
+        if (!level.empty()) {
+            leaf->previous = level.back().get();
+            level.back()->next = leaf.get();
+        }
+        level.push_back(std::move(leaf));
+    }
+
+    while (level.size() > 1) {
+        std::vector<std::unique_ptr<Node>> parents;
+        for (std::size_t begin{}; begin < level.size(); begin += build_fill) {
+            auto parent{std::make_unique<Node>()};
+            parent->leaf = false;
+            for (std::size_t i{begin}; i < std::min(begin + build_fill, level.size()); ++i) {
+                parent->items.push_back(level[i]->items.front());
+                parent->counts.push_back(level[i]->total);
+                parent->total += level[i]->total;
+                parent->children.push_back(std::move(level[i]));
+            }
+            parents.push_back(std::move(parent));
+        }
+        level = std::move(parents);
+    }
+
+    RadiusBTree tree;
+    if (!level.empty()) {
+        tree._root = std::move(level.front());
+    }
+    return tree;
+}
+
+void RadiusBTree::insert(const RadiusItem& item) {
+    if (auto sibling{_root->insert(item)}) {
+        auto root{std::make_unique<Node>()};
+        root->leaf = false;
+        root->items = {_root->items.front(), sibling->items.front()};
+        root->counts = {_root->total, sibling->total};
+        root->total = _root->total + sibling->total;
+        root->children.push_back(std::move(_root));
+        root->children.push_back(std::move(sibling));
+        _root = std::move(root);
+    }
+}
+
+bool RadiusBTree::erase(const RadiusItem& item) {
+    if (!_root->erase(item)) {
+        return false;
+    }
+    while (!_root->leaf && _root->children.size() == 1) {
+        _root = std::move(_root->children.front());
+    }
+    if (!_root->leaf && _root->children.empty()) {
+        _root = std::make_unique<Node>();
+    }
+    return true;
+}
+
+std::size_t RadiusBTree::size() const {
+    return _root->total;
+}
+
+std::size_t RadiusBTree::rank(double radius) const {
+    const RadiusItem key{radius, 0};
+    std::size_t result{};
+    const Node* node{_root.get()};
+    while (!node->leaf) {
+        const auto child{node->route_below(key)};
+        result += std::accumulate(node->counts.begin(), node->counts.begin() + static_cast<std::ptrdiff_t>(child),
+            std::size_t{});
+        node = node->children[child].get();
+    }
+    return result + static_cast<std::size_t>(
+                        std::lower_bound(node->items.begin(), node->items.end(), key) - node->items.begin());
+}
+
+RadiusBTree::Position RadiusBTree::lower_bound(const RadiusItem& key) const {
+    const Node* node{_root.get()};
+    while (!node->leaf) {
+        node = node->children[node->route_below(key)].get();
+    }
+    const auto index{
+        static_cast<std::size_t>(std::lower_bound(node->items.begin(), node->items.end(), key) - node->items.begin())};
+    if (index == node->items.size() && node->next) {
+        return Position{node->next, 0};
+    }
+    return Position{node, index};
+}
+
+std::vector<RadiusItem> RadiusBTree::range(double min, double max) const {
+    std::vector<RadiusItem> result;
+    if (!(min <= max)) {
+        return result;
+    }
+    for (auto [leaf, index]{lower_bound(RadiusItem{min, 0})}; leaf; leaf = leaf->next, index = 0) {
+        for (; index < leaf->items.size(); ++index) {
+            if (leaf->items[index].radius > max) {
+                return result;
+            }
+            result.push_back(leaf->items[index]);
+        }
+    }
+    return result;
+}
+
+std::vector<RadiusItem> RadiusBTree::nearest(double radius, std::size_t k) const {
+    auto left{lower_bound(RadiusItem{radius, 0})};
+    auto right{left};
+    return merge_nearest(
+        radius,
+        k,
+        [&]() -> std::optional<RadiusItem> {
+            while (left.index == 0) {
+                if (!left.leaf->previous) {
+                    return std::nullopt;
+                }
+                left = Position{left.leaf->previous, left.leaf->previous->items.size()};
+            }
+            return left.leaf->items[--left.index];
+        },
+        [&]() -> std::optional<RadiusItem> {
+            while (right.index == right.leaf->items.size()) {
+                if (!right.leaf->next) {
+                    return std::nullopt;
+                }
+                right = Position{right.leaf->next, 0};
+            }
+            return right.leaf->items[right.index++];
+        });
+}
+
+} // namespace index
+
+namespace model3d {
+
+MemoryUsage memory_usage(const index::RadiusBTree& tree) {
+    MemoryUsage usage;
+    std::vector<const index::RadiusBTree::Node*> nodes{tree._root.get()};
+    while (!nodes.empty()) {
+        const auto* node{nodes.back()};
+        nodes.pop_back();
+
+        usage.index += sizeof(index::RadiusBTree::Node);
+        usage.allocator_overhead += get_allocation_overhead(sizeof(index::RadiusBTree::Node));
+        usage += get_buffer_usage(node->items, false);
+        usage += get_buffer_usage(node->children, false);
+        usage += get_buffer_usage(node->counts, false);
+        for (const auto& child : node->children) {
+            nodes.push_back(child.get());
+        }
+    }
+    return usage;
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,93 @@
+#include "curves/index/RadiusIndex.h"
+
+#include "curves/model3d/Circle.h"
+#include "curves/parallel/ParallelSort.h"
+
+namespace curves {
+namespace index {
+
+namespace {
+
+// In-order traversal of the implicit tree assigns the sorted items to the Eytzinger nodes
+std::size_t fill_eytzinger(const std::vector<RadiusItem>& items,
+    std::vector<double>& eytzinger,
+    std::vector<std::uint32_t>& ranks,
+    std::size_t position,
+    std::size_t node) {
+    if (node < eytzinger.size()) {
+        position = fill_eytzinger(items, eytzinger, ranks, position, 2 * node);
+        eytzinger[node] = items[position].radius;
+        ranks[node] = static_cast<std::uint32_t>(position);
+        position = fill_eytzinger(items, eytzinger, ranks, position + 1, 2 * node + 1);
+    }
+    return position;
+}
+
+} // namespace
+
+std::vector<RadiusItem> get_sorted_items(std::span<const double> radii, parallel::Executor* executor) {
+    std::vector<RadiusItem> items(radii.size());
+    for (std::size_t i{}; i < radii.size(); ++i) {
+        items[i] = {radii[i], static_cast<std::uint32_t>(i)};
+    }
+
+    parallel::parallel_sort(items, executor);
+    return items;
+}
+
+std::vector<double> get_radii(std::span<const std::shared_ptr<model3d::Circle>> circles) {
+    std::vector<double> radii;
+    radii.reserve(circles.size());
+    for (const auto& circle : circles) {
+        radii.push_back(circle->get_radius());
+    }
+    return radii;
+}
+
+RadiusIndex RadiusIndex::build(std::span<const double> radii, parallel::Executor* executor) {
+    RadiusIndex index;
+    index._items = get_sorted_items(radii, executor);
+    index._eytzinger.resize(index._items.size() + 1);
+    index._eytzinger_rank.resize(index._items.size() + 1);
+    fill_eytzinger(index._items, index._eytzinger, index._eytzinger_rank, 0, 1);
+    return index;
+}
+
+std::size_t RadiusIndex::rank(double radius) const {
+    // Branch-free descent: go right while the node is smaller. The last left turn is the answer,
+    // it is recovered by dropping the trailing right turns (ones) and the left turn itself.
+    const std::size_t count{_items.size()};
+    std::size_t node{1};
+    while (node <= count) {
+        node = 2 * node + static_cast<std::size_t>(_eytzinger[node] < radius);
+    }
+    node >>= std::countr_one(node) + 1;
+    return node == 0 ? count : _eytzinger_rank[node];
+}
+
+std::span<const RadiusItem> RadiusIndex::range(double min, double max) const {
+    if (!(min <= max)) {
+        return {};
+    }
+    const std::size_t begin{rank(min)};
+    const auto end{std::upper_bound(_items.begin() + begin, _items.end(), max,
+        [](double value, const RadiusItem& item) { return value < item.radius; })};
+    return std::span<const RadiusItem>{_items}.subspan(begin, static_cast<std::size_t>(end - _items.begin()) - begin);
+}
+
+std::vector<RadiusItem> RadiusIndex::nearest(double radius, std::size_t k) const {
+    std::size_t left{rank(radius)};
+    std::size_t right{left};
+    return merge_nearest(
+        radius,
+        k,
+        [&]() -> std::optional<RadiusItem> {
+            return left > 0 ? std::optional{_items[--left]} : std::nullopt;
+        },
+        [&]() -> std::optional<RadiusItem> {
+            return right < _items.size() ? std::optional{_items[right++]} : std::nullopt;
+        });
+}
+
+} // namespace index
+} // namespace curves
@@ -0,0 +1,196 @@
+#include "curves/index/SpatialOrder.h"
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/ParallelSort.h"
+
+namespace curves {
+namespace index {
+
+namespace {
+
+constexpr std::size_t key_grain{1 << 14};
+constexpr std::uint32_t max_cell{(1u << spatial_key_bits) - 1};
+
+struct KeyedIndex {
+    std::uint64_t key;
+    std::uint32_t index;
+
+    auto operator<=>(const KeyedIndex& other) const = default;
+};
+
+// Spreads the lower 21 bits so that two zero bits follow every bit
+std::uint64_t spread_bits(std::uint32_t value) {
+    std::uint64_t x{value & max_cell};
+    x = (x | (x << 32)) & 0x001F00000000FFFFull;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+    x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+}
+
+// Runs task(begin, end) over [0, count), on the executor if given
+template <typename Task>
+void for_ranges(std::size_t count, parallel::Executor* executor, const Task& task) {
+    if (executor && count > key_grain) {
+        executor->parallel_for(count, key_grain, [&](std::size_t begin, std::size_t end, std::size_t) {
+            task(begin, end);
+        });
+    } else {
+        task(0, count);
+    }
+}
+
+} // namespace
+
+std::uint64_t get_morton_key(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+    return spread_bits(x) | (spread_bits(y) << 1) | (spread_bits(z) << 2);
+}
+
+std::uint64_t get_hilbert_key(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+    // Skilling, "Programming the Hilbert curve" (2004): the axes are transformed in place into the transposed
+    // Hilbert index, whose bits are then interleaved like a Morton key
+    std::array<std::uint32_t, 3> axes{x & max_cell, y & max_cell, z & max_cell};
+    constexpr std::uint32_t highest_bit{1u << (spatial_key_bits - 1)};
+
+    for (std::uint32_t q{highest_bit}; q > 1; q >>= 1) {
+        const std::uint32_t p{q - 1};
+        for (std::size_t i{}; i < 3; ++i) {
+            if (axes[i] & q) {
+                axes[0] ^= p; // Invert
+            } else {
+                const std::uint32_t exchanged{(axes[0] ^ axes[i]) & p};
+                axes[0] ^= exchanged;
+                axes[i] ^= exchanged;
+            }
+        }
+    }
+
+    // Gray encode
+    axes[1] ^= axes[0];
+    axes[2] ^= axes[1];
+    std::uint32_t gray{};
+    for (std::uint32_t q{highest_bit}; q > 1; q >>= 1) {
+        if (axes[2] & q) {
+            gray ^= q - 1;
+        }
+    }
+    for (auto& axis : axes) {
+        axis ^= gray;
+    }
+
+    // The first axis supplies the most significant bit of every triple
+    return (spread_bits(axes[0]) << 2) | (spread_bits(axes[1]) << 1) | spread_bits(axes[2]);
+}
+
+Point3d get_center(const model3d::Curve& curve) {
+    if (const auto* circle{dynamic_cast<const model3d::Circle*>(&curve)}) {
+        return circle->get_center();
+    }
+    if (const auto* ellipse{dynamic_cast<const model3d::Ellipse*>(&curve)}) {
+        return ellipse->get_center();
+    }
+    if (const auto* helix{dynamic_cast<const model3d::Helix*>(&curve)}) {
+        return helix->get_center();
+    }
+    return curve.get_point(0.0);
+}
+
+std::vector<std::uint64_t> get_spatial_keys(
+    std::span<const Point3d> centers, Spatial_key key, parallel::Executor* executor) {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+    min.fill(std::numeric_limits<double>::infinity());
+    max.fill(-std::numeric_limits<double>::infinity());
+    for (const auto& center : centers) {
+        for (std::size_t axis{}; axis < 3; ++axis) {
+            min[axis] = std::min(min[axis], center.data()[axis]);
+            max[axis] = std::max(max[axis], center.data()[axis]);
+        }
+    }
+
+    // One scale for all axes keeps the cells cubic
+    double extent{};
+    for (std::size_t axis{}; axis < 3; ++axis) {
+        extent = std::max(extent, max[axis] - min[axis]);
+    }
+    const double scale{extent > 0.0 ? static_cast<double>(max_cell) / extent : 0.0};
+
+    std::vector<std::uint64_t> keys(centers.size());
+    for_ranges(centers.size(), executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            std::array<std::uint32_t, 3> cell{};
+            for (std::size_t axis{}; axis < 3; ++axis) {
+                cell[axis] = static_cast<std::uint32_t>(
+                    std::clamp((centers[i].data()[axis] - min[axis]) * scale, 0.0, static_cast<double>(max_cell)));
+            }
+            keys[i] = key == Spatial_key::hilbert ? get_hilbert_key(cell[0], cell[1], cell[2])
+                                                  : get_morton_key(cell[0], cell[1], cell[2]);
+        }
+    });
+    return keys;
+}
+
+std::vector<std::uint32_t> get_spatial_order(
+    std::span<const Point3d> centers, Spatial_key key, parallel::Executor* executor) {
+    const auto keys{get_spatial_keys(centers, key, executor)};
+
+    // The index breaks ties, so the unstable parallel sort gives the stable order
+    std::vector<KeyedIndex> items(keys.size());
+    for (std::size_t i{}; i < keys.size(); ++i) {
+        items[i] = {keys[i], static_cast<std::uint32_t>(i)};
+    }
+    parallel::parallel_sort(items, executor);
+
+    std::vector<std::uint32_t> order(items.size());
+    for (std::size_t i{}; i < items.size(); ++i) {
+        order[i] = items[i].index;
+    }
+    return order;
+}
+
+std::vector<std::uint32_t> get_spatial_order(
+    std::span<const std::shared_ptr<model3d::Curve>> curves, Spatial_key key, parallel::Executor* executor) {
+    std::vector<Point3d> centers(curves.size());
+    for_ranges(curves.size(), executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            centers[i] = get_center(*curves[i]);
+        }
+    });
+    return get_spatial_order(centers, key, executor);
+}
+
+std::vector<std::uint32_t> reorder_spatially(
+    std::vector<std::shared_ptr<model3d::Curve>>& curves, Spatial_key key, parallel::Executor* executor) {
+    auto order{get_spatial_order(curves, key, executor)};
+
+    std::vector<std::shared_ptr<model3d::Curve>> reordered(curves.size());
+    for_ranges(curves.size(), executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            reordered[i] = std::move(curves[order[i]]);
+        }
+    });
+    curves.swap(reordered);
+    return order;
+}
+
+std::vector<std::uint32_t> reorder_spatially(
+    model3d::CurveStore& store, Spatial_key key, parallel::Executor* executor) {
+    std::vector<Point3d> centers(store.size());
+    for_ranges(store.size(), executor, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            centers[i] = get_center(store[i]);
+        }
+    });
+
+    auto order{get_spatial_order(centers, key, executor)};
+    store = store.reordered(order);
+    return order;
+}
+
+} // namespace index
+} // namespace curves
@@ -0,0 +1,105 @@
+#include "curves/intersection3d/CircleAxisIndex.h"
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Trace.h"
+
+namespace curves {
+namespace intersection3d {
+
+namespace {
+
+constexpr double min_cell_size{1e-12};
+
+std::array<std::int64_t, 3> get_cell_coordinates(Vector3d axis, double cell_size) {
+    axis.normalize();
+    return {static_cast<std::int64_t>(std::floor(axis.x() / cell_size)),
+        static_cast<std::int64_t>(std::floor(axis.y() / cell_size)),
+        static_cast<std::int64_t>(std::floor(axis.z() / cell_size))};
+}
+
+} // namespace
+
+CircleAxisIndex::CircleAxisIndex(std::span<const std::shared_ptr<model3d::Circle>> circles, double precision)
+    : _circles{circles.begin(), circles.end()}
+    , _precision{precision}
+    // Unit axes parallel up to the precision differ by less than the precision in every coordinate
+    , _cell_size{std::max(2.0 * precision, min_cell_size)} {
+    for (std::size_t i{}; i < _circles.size(); ++i) {
+        const auto [x, y, z]{get_cell_coordinates(_circles[i]->get_axis(), _cell_size)};
+        _cells[get_cell_key(x, y, z)].push_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+std::uint64_t CircleAxisIndex::get_cell_key(std::int64_t x, std::int64_t y, std::int64_t z) const {
+    // Different cells may share a key. That only adds candidates: the exact axis test is still done per circle.
+    return (static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ull)
+        ^ (static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4Full)
+        ^ (static_cast<std::uint64_t>(z) * 0x165667B19E3779F9ull);
+}
+
+std::vector<std::uint64_t> CircleAxisIndex::get_parallel_cells(const Vector3d& axis) const {
+    std::vector<std::uint64_t> result;
+    result.reserve(54);
+    for (const double sign : {1.0, -1.0}) {
+        const auto [x, y, z]{get_cell_coordinates(axis * sign, _cell_size)};
+        for (std::int64_t dx{-1}; dx <= 1; ++dx) {
+            for (std::int64_t dy{-1}; dy <= 1; ++dy) {
+                for (std::int64_t dz{-1}; dz <= 1; ++dz) {
+                    result.push_back(get_cell_key(x + dx, y + dy, z + dz));
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::span<const std::uint32_t> CircleAxisIndex::get_cell(std::uint64_t cell) const {
+    const auto it{_cells.find(cell)};
+    if (it == _cells.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+std::size_t get_intersection(
+    const model3d::Helix& helix, const CircleAxisIndex& circles, std::vector<CircleIntersection>& out) {
+    parallel::TraceSpan span{"intersection3d::get_intersection(CircleAxisIndex)"};
+    const auto first_new{out.size()};
+    const auto parallel_cells{circles.get_parallel_cells(helix.get_axis())};
+    const double precision{circles.get_precision()};
+
+    thread_local std::vector<IntersectionHit> hits{};
+    auto append_hits = [&](std::size_t circle_index) {
+        for (const auto& hit : hits) {
+            out.push_back(CircleIntersection{circle_index, hit});
+        }
+        hits.clear();
+    };
+
+    // Only the parallel cells are visited. The other circles would go to get_intersection_hits_non_parallel, which
+    // finds no hits yet: walking them would cost O(N) per query for nothing.
+    for (const auto cell : parallel_cells) {
+        for (const auto index : circles.get_cell(cell)) {
+            get_intersection_hits(helix, *circles[index], hits, precision);
+            append_hits(index);
+        }
+    }
+
+    std::stable_sort(out.begin() + first_new, out.end(), [](const auto& first, const auto& second) {
+        return first.circle_index < second.circle_index;
+    });
+    return out.size() - first_new;
+}
+
+std::vector<CircleIntersection> get_intersection(const model3d::Helix& helix, const CircleAxisIndex& circles) {
+    std::vector<CircleIntersection> result{};
+    get_intersection(helix, circles, result);
+    return result;
+}
+
+} // namespace intersection3d
+} // namespace curves
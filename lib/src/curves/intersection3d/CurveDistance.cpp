@@ -0,0 +1,334 @@
+#include "curves/intersection3d/CurveDistance.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveEvaluation.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace intersection3d {
+
+namespace {
+
+constexpr std::size_t max_box_count{1 << 20}; // Guards against a tolerance below what doubles can resolve
+constexpr std::size_t max_initial_pieces{64};
+constexpr double initial_piece_width{math::pi / 8.0};
+
+double get_distance(const Point3d& first, const Point3d& second) {
+    return std::sqrt(math::get_sqr_distance(first, second));
+}
+
+bool is_bounded(const ParameterRange& range) {
+    return !std::isinf(range.min) && !std::isinf(range.max);
+}
+
+// Piece of a curve over [mid - half_width, mid + half_width]: the tangent segment P(mid) + P'(mid) * s,
+// |s| <= half_width, deviates from the curve by at most A * half_width^2 / 2 (A is get_max_acceleration)
+struct Piece {
+    Point3d point;
+    Vector3d tangent;
+    double mid;
+    double half_width;
+    double deviation;
+};
+
+Piece get_piece(const model3d::Curve& curve, double t0, double t1) {
+    const double mid{(t0 + t1) / 2.0};
+    const double half_width{(t1 - t0) / 2.0};
+    const auto evaluation{curve.evaluate(mid, 1)};
+    return Piece{evaluation.point,
+        evaluation.first_derivative,
+        mid,
+        half_width,
+        curve.get_max_acceleration() * half_width * half_width / 2.0};
+}
+
+struct SegmentClosest {
+    double t_a;
+    double t_b;
+    double distance;
+};
+
+// Closest points of the tangent segments of two pieces (Ericson, Real-Time Collision Detection, 5.1.9)
+SegmentClosest get_segment_closest(const Piece& a, const Piece& b) {
+    const auto d1{a.tangent * (2.0 * a.half_width)};
+    const auto d2{b.tangent * (2.0 * b.half_width)};
+    const auto p1{math::translate(a.point, a.tangent * -a.half_width)};
+    const auto p2{math::translate(b.point, b.tangent * -b.half_width)};
+    const auto r{p1 - p2};
+
+    const double aa{math::scalar_product(d1, d1)};
+    const double ee{math::scalar_product(d2, d2)};
+    const double f{math::scalar_product(d2, r)};
+    const double c{math::scalar_product(d1, r)};
+    const double bb{math::scalar_product(d1, d2)};
+    const double denominator{aa * ee - bb * bb};
+
+    double s{denominator > 0.0 ? std::clamp((bb * f - c * ee) / denominator, 0.0, 1.0) : 0.0};
+    double t{(bb * s + f) / ee};
+    if (t < 0.0) {
+        t = 0.0;
+        s = std::clamp(-c / aa, 0.0, 1.0);
+    } else if (t > 1.0) {
+        t = 1.0;
+        s = std::clamp((bb - c) / aa, 0.0, 1.0);
+    }
+
+    const auto closest_a{math::translate(p1, d1 * s)};
+    const auto closest_b{math::translate(p2, d2 * t)};
+    return SegmentClosest{a.mid + (2.0 * s - 1.0) * a.half_width,
+        b.mid + (2.0 * t - 1.0) * b.half_width,
+        get_distance(closest_a, closest_b)};
+}
+
+struct Box {
+    Piece a;
+    Piece b;
+    double lower; // Lower bound of the distance between the pieces
+};
+
+// Best-first branch-and-bound over pairs of pieces. Stops as soon as a distance below stop_below is found,
+// pieces that cannot come closer than min(best, ignore_from) - tolerance are pruned.
+CurveDistance search(const model3d::Curve& first,
+    const ParameterRange& range_a,
+    const model3d::Curve& second,
+    const ParameterRange& range_b,
+    double tolerance,
+    double stop_below,
+    double ignore_from) {
+    CurveDistance best{range_a.min, range_b.min, std::numeric_limits<double>::infinity()};
+
+    std::vector<Box> heap;
+    const auto compare = [](const Box& first_box, const Box& second_box) { return first_box.lower > second_box.lower; };
+    const auto get_cutoff = [&]() { return std::min(best.distance, ignore_from) - tolerance; };
+
+    const auto add = [&](const Piece& a, const Piece& b) {
+        const auto closest{get_segment_closest(a, b)};
+        const double distance{get_distance(first.get_point(closest.t_a), second.get_point(closest.t_b))};
+        if (distance < best.distance) {
+            best = CurveDistance{closest.t_a, closest.t_b, distance};
+        }
+
+        const double lower{closest.distance - a.deviation - b.deviation};
+        if (lower < get_cutoff()) {
+            heap.push_back(Box{a, b, lower});
+            std::push_heap(heap.begin(), heap.end(), compare);
+        }
+    };
+
+    const auto split_range = [](const model3d::Curve& curve, const ParameterRange& range) {
+        const double length{range.max - range.min};
+        const auto count{static_cast<std::size_t>(std::clamp(
+            std::ceil(length / initial_piece_width), 1.0, static_cast<double>(max_initial_pieces)))};
+        std::vector<Piece> pieces;
+        for (std::size_t i{}; i < count; ++i) {
+            const double t0{range.min + length * static_cast<double>(i) / static_cast<double>(count)};
+            const double t1{range.min + length * static_cast<double>(i + 1) / static_cast<double>(count)};
+            pieces.push_back(get_piece(curve, t0, t1));
+        }
+        return pieces;
+    };
+
+    const auto pieces_b{split_range(second, range_b)};
+    for (const auto& a : split_range(first, range_a)) {
+        for (const auto& b : pieces_b) {
+            add(a, b);
+        }
+    }
+
+    for (std::size_t box_count{}; !heap.empty() && box_count < max_box_count; ++box_count) {
+        if (best.distance < stop_below) {
+            break;
+        }
+
+        std::pop_heap(heap.begin(), heap.end(), compare);
+        const Box box{heap.back()};
+        heap.pop_back();
+        if (box.lower >= get_cutoff()) {
+            break; // The heap is ordered by the lower bound, no other box can improve the result
+        }
+
+        // Split the piece with the larger deviation, it dominates the gap between the bounds
+        if (box.a.deviation >= box.b.deviation) {
+            const double t0{box.a.mid - box.a.half_width};
+            const double t1{box.a.mid + box.a.half_width};
+            add(get_piece(first, t0, box.a.mid), box.b);
+            add(get_piece(first, box.a.mid, t1), box.b);
+        } else {
+            const double t0{box.b.mid - box.b.half_width};
+            const double t1{box.b.mid + box.b.half_width};
+            add(box.a, get_piece(second, t0, box.b.mid));
+            add(box.a, get_piece(second, box.b.mid, t1));
+        }
+    }
+
+    return best;
+}
+
+bool are_coaxial(const Point3d& first_center,
+    const Vector3d& first_axis,
+    const Point3d& second_center,
+    const Vector3d& second_axis) {
+    if (math::cross_product(first_axis, second_axis).get_sqr_magnitude() > math::sqr_precision) {
+        return false;
+    }
+    return math::cross_product(second_center - first_center, first_axis).get_sqr_magnitude() <= math::sqr_precision;
+}
+
+CurveDistance get_coaxial_distance(const model3d::Circle& first, const model3d::Circle& second) {
+    // Every pair of points at the same angle around the common axis is closest:
+    // distance = sqrt((R1 - R2)^2 + h^2) where h is the distance of the planes
+    const auto first_point{first.get_point(0.0)};
+    const auto direction{first_point - first.get_center()};
+    const auto second_point{
+        math::translate(second.get_center(), direction * (second.get_radius() / first.get_radius()))};
+    const double t_b{second.get_parameter(second_point)};
+    return CurveDistance{0.0, t_b, get_distance(first_point, second.get_point(t_b))};
+}
+
+CurveDistance get_coaxial_distance(
+    const model3d::Helix& helix, const model3d::Circle& circle, const ParameterRange& helix_range) {
+    // The distance of a helix point to the circle is sqrt((R1 - R2)^2 + dh^2), dh being its height above the
+    // circle plane, so the closest helix point is the one in the plane or the range end nearest to it
+    const double height{math::scalar_product(circle.get_center() - helix.get_center(), helix.get_axis())};
+    const double helix_parameter{
+        std::clamp(height * math::two_pi / helix.get_step(), helix_range.min, helix_range.max)};
+    const auto helix_point{helix.get_point(helix_parameter)};
+    const double circle_parameter{circle.get_parameter(helix_point)};
+    return CurveDistance{
+        helix_parameter, circle_parameter, get_distance(helix_point, circle.get_point(circle_parameter))};
+}
+
+std::optional<CurveDistance> get_closed_form_distance(
+    const model3d::Curve& first, const model3d::Curve& second, const ParameterRange& helix_range) {
+    const auto* first_circle{dynamic_cast<const model3d::Circle*>(&first)};
+    const auto* second_circle{dynamic_cast<const model3d::Circle*>(&second)};
+    const auto* first_helix{dynamic_cast<const model3d::Helix*>(&first)};
+    const auto* second_helix{dynamic_cast<const model3d::Helix*>(&second)};
+
+    if (first_circle && second_circle
+        && are_coaxial(first_circle->get_center(),
+            first_circle->get_axis(),
+            second_circle->get_center(),
+            second_circle->get_axis())) {
+        return get_coaxial_distance(*first_circle, *second_circle);
+    }
+    if (first_helix && second_circle
+        && are_coaxial(first_helix->get_center(),
+            first_helix->get_axis(),
+            second_circle->get_center(),
+            second_circle->get_axis())) {
+        return get_coaxial_distance(*first_helix, *second_circle, helix_range);
+    }
+    if (first_circle && second_helix
+        && are_coaxial(second_helix->get_center(),
+            second_helix->get_axis(),
+            first_circle->get_center(),
+            first_circle->get_axis())) {
+        const auto result{get_coaxial_distance(*second_helix, *first_circle, helix_range)};
+        return CurveDistance{result.t_b, result.t_a, result.distance};
+    }
+    return std::nullopt;
+}
+
+// Parameter range searched on the curve before the reduction of unbounded helix ranges
+ParameterRange get_domain(const model3d::Curve& curve, const ParameterRange& helix_range) {
+    if (dynamic_cast<const model3d::Helix*>(&curve)) {
+        return helix_range;
+    }
+    return ParameterRange{0.0, math::two_pi};
+}
+
+ParameterRange get_first_turn(const ParameterRange& range) {
+    if (!std::isinf(range.min)) {
+        return ParameterRange{range.min, std::min(range.max, range.min + math::two_pi)};
+    }
+    if (!std::isinf(range.max)) {
+        return ParameterRange{range.max - math::two_pi, range.max};
+    }
+    return ParameterRange{0.0, math::two_pi};
+}
+
+Sphere get_bounding_sphere(const model3d::Curve& curve, const ParameterRange& range) {
+    if (const auto* circle{dynamic_cast<const model3d::Circle*>(&curve)}) {
+        return Sphere{circle->get_center(), circle->get_radius()};
+    }
+    if (const auto* ellipse{dynamic_cast<const model3d::Ellipse*>(&curve)}) {
+        return Sphere{ellipse->get_center(), ellipse->get_radius_major()};
+    }
+    const auto piece{get_piece(curve, range.min, range.max)};
+    return Sphere{piece.point, piece.tangent.get_magnitude() * piece.half_width + piece.deviation};
+}
+
+// Helix points farther along the axis from the sphere than an upper bound of the minimum distance can not be closest
+ParameterRange reduce_helix_range(const model3d::Helix& helix,
+    const ParameterRange& range,
+    const model3d::Curve& other,
+    const ParameterRange& other_range) {
+    const auto sphere{get_bounding_sphere(other, other_range)};
+    const double pitch{helix.get_step() / math::two_pi};
+    const double height{math::scalar_product(sphere.center - helix.get_center(), helix.get_axis())};
+
+    const double nearest_parameter{std::clamp(height / pitch, range.min, range.max)};
+    const double upper_bound{get_distance(
+        helix.get_point(nearest_parameter), other.get_point((other_range.min + other_range.max) / 2.0))};
+    const double reach{sphere.radius + upper_bound};
+
+    const double below{(height - reach) / pitch};
+    const double above{(height + reach) / pitch};
+    const double t0{std::min(below, above)};
+    const double t1{std::max(below, above)};
+    return ParameterRange{std::max(t0, range.min), std::min(t1, range.max)};
+}
+
+CurveDistance find_min_distance(const model3d::Curve& first,
+    const model3d::Curve& second,
+    double tolerance,
+    const ParameterRange& helix_range,
+    double stop_below,
+    double ignore_from) {
+    if (const auto closed_form{get_closed_form_distance(first, second, helix_range)}) {
+        return *closed_form;
+    }
+
+    auto range_a{get_domain(first, helix_range)};
+    auto range_b{get_domain(second, helix_range)};
+    if (!is_bounded(range_a) && !is_bounded(range_b)) {
+        range_a = get_first_turn(range_a);
+    }
+    if (!is_bounded(range_a)) {
+        range_a = reduce_helix_range(dynamic_cast<const model3d::Helix&>(first), range_a, second, range_b);
+    }
+    if (!is_bounded(range_b)) {
+        range_b = reduce_helix_range(dynamic_cast<const model3d::Helix&>(second), range_b, first, range_a);
+    }
+
+    return search(first, range_a, second, range_b, tolerance, stop_below, ignore_from);
+}
+
+} // namespace
+
+CurveDistance get_min_distance(const model3d::Curve& first,
+    const model3d::Curve& second,
+    double tolerance,
+    const ParameterRange& helix_range) {
+    return find_min_distance(first,
+        second,
+        tolerance,
+        helix_range,
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity());
+}
+
+bool is_closer_than(const model3d::Curve& first,
+    const model3d::Curve& second,
+    double distance,
+    double tolerance,
+    const ParameterRange& helix_range) {
+    return find_min_distance(first, second, tolerance, helix_range, distance, distance).distance < distance;
+}
+
+} // namespace intersection3d
+} // namespace curves
@@ -5,14 +5,17 @@
 #include "curves/math/Point.h"
 #include "curves/model3d/Circle.h"
 #include "curves/model3d/Helix.h"
+#include "curves/parallel/Trace.h"
 
 namespace curves {
 namespace intersection3d {
 
 namespace {
 
-std::optional<std::vector<Point3d>> get_intersection_circle_and_helix_collinear_axis(
-    const model3d::Helix& helix, const model3d::Circle& circle, double precision) {
+std::optional<std::size_t> get_intersection_circle_and_helix_collinear_axis(const model3d::Helix& helix,
+    const model3d::Circle& circle,
+    std::vector<IntersectionHit>& out,
+    double precision) {
     const double sqr_precision{precision * precision};
     if (math::cross_product(helix.get_axis(), circle.get_axis()).get_sqr_magnitude() > sqr_precision) {
         return std::nullopt;
@@ -24,27 +27,88 @@ std::optional<std::vector<Point3d>> get_intersection_circle_and_helix_collinear_
 
     const auto helix_point{helix.get_point(helix_parameter)};
 
-    if (circle.belongs(helix_point, precision)) {
-        return std::vector<Point3d>{helix_point};
+    if (!circle.belongs(helix_point, precision)) {
+        return 0;
     }
 
-    return std::vector<Point3d>{};
+    const double circle_parameter{circle.get_parameter(helix_point)};
+    out.push_back(IntersectionHit{helix_parameter,
+        circle_parameter,
+        helix_point,
+        get_intersection_kind(
+            helix.get_first_derivative(helix_parameter), circle.get_first_derivative(circle_parameter))});
+    return 1;
 }
 
 } // namespace
 
+Intersection_kind get_intersection_kind(const Vector3d& first_tangent, const Vector3d& second_tangent) {
+    const double sqr_sine_scaled{math::cross_product(first_tangent, second_tangent).get_sqr_magnitude()};
+    const double sqr_magnitudes{first_tangent.get_sqr_magnitude() * second_tangent.get_sqr_magnitude()};
+    return sqr_sine_scaled <= math::sqr_precision * sqr_magnitudes ? Intersection_kind::tangent
+                                                                   : Intersection_kind::transversal;
+}
+
 std::vector<Point3d> get_intersection(const model3d::Helix& helix, const model3d::Circle& circle, double precision) {
-    if (const auto& intersection_opt{get_intersection_circle_and_helix_collinear_axis(helix, circle, precision)}) {
-        return *intersection_opt;
-    }
+    parallel::TraceSpan span{"intersection3d::get_intersection"};
+    thread_local std::vector<IntersectionHit> hits{};
+    hits.clear();
+    get_intersection_hits(helix, circle, hits, precision);
 
-    // Currently, intersection for non-collinear axes is not implemented or in development
-    return {};
+    std::vector<Point3d> result{};
+    result.reserve(hits.size());
+    for (const auto& hit : hits) {
+        result.push_back(hit.point);
+    }
+    return result;
 }
 
 std::vector<Point3d> get_intersection(const model3d::Circle& circle, const model3d::Helix& helix, double precision) {
     return get_intersection(helix, circle, precision);
 }
 
+std::vector<IntersectionHit> get_intersection_hits(
+    const model3d::Helix& helix, const model3d::Circle& circle, double precision) {
+    std::vector<IntersectionHit> result{};
+    get_intersection_hits(helix, circle, result, precision);
+    return result;
+}
+
+std::vector<IntersectionHit> get_intersection_hits(
+    const model3d::Circle& circle, const model3d::Helix& helix, double precision) {
+    std::vector<IntersectionHit> result{};
+    get_intersection_hits(circle, helix, result, precision);
+    return result;
+}
+
+std::size_t get_intersection_hits(const model3d::Helix& helix,
+    const model3d::Circle& circle,
+    std::vector<IntersectionHit>& out,
+    double precision) {
+    if (const auto& count_opt{get_intersection_circle_and_helix_collinear_axis(helix, circle, out, precision)}) {
+        return *count_opt;
+    }
+
+    return get_intersection_hits_non_parallel(helix, circle, out, precision);
+}
+
+std::size_t get_intersection_hits_non_parallel(
+    const model3d::Helix&, const model3d::Circle&, std::vector<IntersectionHit>&, double) {
+    // Currently, intersection for non-collinear axes is not implemented or in development
+    return 0;
+}
+
+std::size_t get_intersection_hits(const model3d::Circle& circle,
+    const model3d::Helix& helix,
+    std::vector<IntersectionHit>& out,
+    double precision) {
+    const auto first_new{out.size()};
+    const auto count{get_intersection_hits(helix, circle, out, precision)};
+    for (auto i{first_new}; i < out.size(); ++i) {
+        std::swap(out[i].t_a, out[i].t_b);
+    }
+    return count;
+}
+
 } // namespace intersection3d
-} // namespace curves
\ No newline at end of file
+} // namespace curves
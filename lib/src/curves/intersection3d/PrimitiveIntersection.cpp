@@ -0,0 +1,650 @@
+#include "curves/intersection3d/PrimitiveIntersection.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace intersection3d {
+
+namespace {
+
+constexpr std::size_t max_bisection_iterations{200};
+constexpr double root_search_step{math::pi / 16.0}; // Sampling step for the numeric critical point search
+
+// Common parameterization of the supported curves in their local frame:
+// P(t) = C + a * cos(t) * U + b * sin(t) * V + pitch * t * N
+// pitch is zero for closed curves (circle, ellipse) and step / 2pi for a helix
+struct CurveForm {
+    Point3d center;
+    Vector3d u;
+    Vector3d v;
+    Vector3d n;
+    double a;
+    double b;
+    double pitch;
+
+    bool is_closed() const { return pitch == 0.0; }
+
+    // Coordinates of the point in the (U, V, N) frame relative to the center
+    Vector3d to_local(const Point3d& point) const { return to_local(point - center); }
+    Vector3d to_local(const Vector3d& vector) const {
+        return Vector3d{
+            math::scalar_product(vector, u), math::scalar_product(vector, v), math::scalar_product(vector, n)};
+    }
+};
+
+std::optional<CurveForm> get_form(const model3d::Curve& curve) {
+    if (const auto* circle{dynamic_cast<const model3d::Circle*>(&curve)}) {
+        return CurveForm{circle->get_center(),
+            circle->get_axis_x(),
+            circle->get_axis_y(),
+            circle->get_axis(),
+            circle->get_radius(),
+            circle->get_radius(),
+            0.0};
+    }
+    if (const auto* ellipse{dynamic_cast<const model3d::Ellipse*>(&curve)}) {
+        return CurveForm{ellipse->get_center(),
+            ellipse->get_axis_x(),
+            ellipse->get_axis_y(),
+            ellipse->get_axis(),
+            ellipse->get_radius_major(),
+            ellipse->get_radius_minor(),
+            0.0};
+    }
+    if (const auto* helix{dynamic_cast<const model3d::Helix*>(&curve)}) {
+        return CurveForm{helix->get_center(),
+            helix->get_axis_x(),
+            helix->get_axis_y(),
+            helix->get_axis(),
+            helix->get_radius(),
+            helix->get_radius(),
+            helix->get_step() / math::two_pi};
+    }
+    return std::nullopt;
+}
+
+double normalize_angle(double angle) {
+    angle = std::fmod(angle, math::two_pi);
+    if (angle < 0.0) {
+        angle += math::two_pi;
+    }
+    return angle < math::two_pi ? angle : 0.0; // Tiny negative angles round up to 2pi
+}
+
+// Parameter interval searched on a helix when the primitive cuts it infinitely many times
+ParameterRange get_periodic_range(const ParameterRange& range) {
+    if (std::isinf(range.min) || std::isinf(range.max)) {
+        return ParameterRange{0.0, math::two_pi};
+    }
+    return range;
+}
+
+struct Root {
+    double t;
+    Intersection_kind kind;
+};
+
+// Adds root.t + 2pi * k for every turn k inside the range
+void add_periodic_roots(Root root, const ParameterRange& range, std::vector<Root>& roots) {
+    const double first_turn{std::floor((range.min - root.t) / math::two_pi)};
+    for (double turn{first_turn}; root.t + turn * math::two_pi <= range.max; turn += 1.0) {
+        const double t{root.t + turn * math::two_pi};
+        if (t >= range.min) {
+            roots.push_back(Root{t, root.kind});
+        }
+    }
+}
+
+// A * cos(t) + B * sin(t) = R * cos(t - phi), solved once per curve and reused for any right-hand side
+class TrigEquation {
+public:
+    TrigEquation(double a, double b) : _magnitude{std::hypot(a, b)}, _phase{std::atan2(b, a)} {};
+
+    // Solutions of A * cos(t) + B * sin(t) = c in [0, 2pi). tolerance is the allowed residual of the equation.
+    void solve(double c, double tolerance, std::vector<Root>& roots) const {
+        if (_magnitude <= tolerance) {
+            if (std::abs(c) <= tolerance) {
+                roots.push_back(Root{0.0, Intersection_kind::overlap});
+            }
+            return;
+        }
+
+        if (std::abs(c) > _magnitude + tolerance) {
+            return;
+        }
+
+        if (std::abs(c) >= _magnitude - tolerance) {
+            roots.push_back(Root{normalize_angle(c > 0.0 ? _phase : _phase + math::pi), Intersection_kind::tangent});
+            return;
+        }
+
+        const double delta{std::acos(c / _magnitude)};
+        roots.push_back(Root{normalize_angle(_phase - delta), Intersection_kind::transversal});
+        roots.push_back(Root{normalize_angle(_phase + delta), Intersection_kind::transversal});
+    }
+
+private:
+    double _magnitude;
+    double _phase;
+};
+
+template <typename F>
+double bisect(const F& f, double left, double right, double left_value) {
+    for (std::size_t i{}; i < max_bisection_iterations; ++i) {
+        const double middle{0.5 * (left + right)};
+        if (middle <= left || middle >= right) {
+            break;
+        }
+        const double middle_value{f(middle)};
+        if (middle_value == 0.0) {
+            return middle;
+        }
+        if ((middle_value < 0.0) == (left_value < 0.0)) {
+            left = middle;
+            left_value = middle_value;
+        } else {
+            right = middle;
+        }
+    }
+    return 0.5 * (left + right);
+}
+
+// Roots of f on [t0, t1]. critical_points must contain every extremum of f inside the interval, sorted,
+// so that f is monotone between neighbouring break points and has at most one simple root there.
+template <typename F>
+void find_roots(const F& f,
+    std::span<const double> critical_points,
+    double t0,
+    double t1,
+    double tolerance,
+    std::vector<Root>& roots) {
+    double left{t0};
+    double left_value{f(t0)};
+    bool left_is_root{false};
+    if (left_value == 0.0) {
+        roots.push_back(Root{t0, Intersection_kind::transversal});
+        left_is_root = true;
+    }
+
+    for (std::size_t i{}; i <= critical_points.size(); ++i) {
+        const bool is_last{i == critical_points.size()};
+        const double right{is_last ? t1 : critical_points[i]};
+        const double right_value{f(right)};
+        const bool right_is_tangent{!is_last && std::abs(right_value) <= tolerance};
+
+        if (!left_is_root && !right_is_tangent) {
+            if ((left_value < 0.0 && right_value > 0.0) || (left_value > 0.0 && right_value < 0.0)) {
+                roots.push_back(Root{bisect(f, left, right, left_value), Intersection_kind::transversal});
+            } else if (is_last && right_value == 0.0) {
+                roots.push_back(Root{right, Intersection_kind::transversal});
+            }
+        }
+        if (right_is_tangent) {
+            roots.push_back(Root{right, Intersection_kind::tangent});
+        }
+
+        left = right;
+        left_value = right_value;
+        left_is_root = right_is_tangent;
+    }
+}
+
+// Extrema of f on (t0, t1) located by sign changes of its derivative df
+template <typename DF>
+void find_critical_points(const DF& df, double t0, double t1, std::vector<double>& critical_points) {
+    const auto sample_count{static_cast<std::size_t>(std::ceil((t1 - t0) / root_search_step))};
+    double left{t0};
+    double left_value{df(t0)};
+    for (std::size_t i{1}; i <= sample_count; ++i) {
+        const double right{i == sample_count ? t1 : t0 + static_cast<double>(i) * root_search_step};
+        const double right_value{df(right)};
+        if ((left_value < 0.0 && right_value > 0.0) || (left_value > 0.0 && right_value < 0.0)) {
+            critical_points.push_back(bisect(df, left, right, left_value));
+        } else if (right_value == 0.0 && i != sample_count) {
+            critical_points.push_back(right);
+        }
+        left = right;
+        left_value = right_value;
+    }
+}
+
+void add_hits(const model3d::Curve& curve, std::span<const Root> roots, std::vector<PrimitiveHit>& out) {
+    const auto first_new{out.size()};
+    for (const auto& root : roots) {
+        out.push_back(PrimitiveHit{root.t, curve.get_point(root.t), root.kind});
+    }
+
+    const auto new_hits{std::ranges::subrange(out.begin() + static_cast<std::ptrdiff_t>(first_new), out.end())};
+    std::ranges::sort(new_hits, {}, &PrimitiveHit::t);
+    const auto duplicates{std::ranges::unique(new_hits, [](const PrimitiveHit& first, const PrimitiveHit& second) {
+        return second.t - first.t <= math::sqr_precision;
+    })};
+    out.erase(duplicates.begin(), duplicates.end());
+}
+
+// Plane equation N * P(t) = offset in terms of the curve form:
+// A * cos(t) + B * sin(t) + D * t = c
+struct PlaneEquation {
+    double a;
+    double b;
+    double d;
+    double base; // N * C, c = offset - base
+    bool closed;
+};
+
+PlaneEquation get_plane_equation(const CurveForm& form, const Vector3d& unit_normal) {
+    return PlaneEquation{form.a * math::scalar_product(unit_normal, form.u),
+        form.b * math::scalar_product(unit_normal, form.v),
+        form.pitch * math::scalar_product(unit_normal, form.n),
+        math::scalar_product(unit_normal, Vector3d{form.center.data()}),
+        form.is_closed()};
+}
+
+void solve_plane_equation(const PlaneEquation& equation,
+    const TrigEquation& trig,
+    double offset,
+    double precision,
+    const ParameterRange& helix_range,
+    std::vector<double>& critical_points,
+    std::vector<Root>& roots) {
+    const double c{offset - equation.base};
+
+    // Closed curve or a plane parallel to the helix axis: the equation is periodic
+    if (std::abs(equation.d) * math::two_pi <= precision) {
+        const auto first_root{roots.size()};
+        trig.solve(c, precision, roots);
+        if (equation.closed) {
+            return;
+        }
+
+        // Helix: repeat the solutions of one turn over the searched turns
+        const auto range{get_periodic_range(helix_range)};
+        const auto last_root{roots.size()};
+        for (auto i{first_root}; i < last_root; ++i) {
+            add_periodic_roots(roots[i], range, roots);
+        }
+        roots.erase(roots.begin() + static_cast<std::ptrdiff_t>(first_root),
+            roots.begin() + static_cast<std::ptrdiff_t>(last_root));
+        return;
+    }
+
+    // Helix: the periodic part is bounded by R, so the roots lie in the slab |D * t - c| <= R
+    const double magnitude{std::hypot(equation.a, equation.b)};
+    double t0{(c - magnitude) / equation.d};
+    double t1{(c + magnitude) / equation.d};
+    if (t0 > t1) {
+        std::swap(t0, t1);
+    }
+    t0 = std::max(t0, helix_range.min);
+    t1 = std::min(t1, helix_range.max);
+    if (t0 > t1) {
+        return;
+    }
+
+    // Extrema: f'(t) = B * cos(t) - A * sin(t) + D = R * cos(t + psi) + D = 0, two per turn at most
+    critical_points.clear();
+    if (std::abs(equation.d) < magnitude) {
+        const double psi{std::atan2(equation.a, equation.b)};
+        const double alpha{std::acos(-equation.d / magnitude)};
+        for (const double phase : {alpha - psi, -alpha - psi}) {
+            for (double turn{std::ceil((t0 - phase) / math::two_pi)}; phase + turn * math::two_pi < t1; turn += 1.0) {
+                const double t{phase + turn * math::two_pi};
+                if (t > t0) {
+                    critical_points.push_back(t);
+                }
+            }
+        }
+        std::ranges::sort(critical_points);
+    }
+
+    const auto f{[&](double t) {
+        return equation.a * std::cos(t) + equation.b * std::sin(t) + equation.d * t - c;
+    }};
+    find_roots(f, critical_points, t0, t1, precision, roots);
+}
+
+// Line crossing of a closed curve, direction is normalized
+void intersect_closed_curve_and_line(const CurveForm& form,
+    const Vector3d& origin,
+    const Vector3d& direction,
+    double precision,
+    std::vector<Root>& roots) {
+    const double extent{std::hypot(origin.x(), origin.y()) + std::max(form.a, form.b)};
+
+    // The line crosses the plane of the curve
+    if (std::abs(direction.z()) * extent > precision) {
+        const double s{-origin.z() / direction.z()};
+        const double u{origin.x() + s * direction.x()};
+        const double v{origin.y() + s * direction.y()};
+        const double t{normalize_angle(std::atan2(v / form.b, u / form.a))};
+        if (std::hypot(u - form.a * std::cos(t), v - form.b * std::sin(t)) <= precision) {
+            roots.push_back(Root{t, Intersection_kind::transversal});
+        }
+        return;
+    }
+
+    if (std::abs(origin.z()) > precision) {
+        return;
+    }
+
+    // The line lies in the plane: unit circle and the line in coordinates scaled by the semi-axes
+    const double x0{origin.x() / form.a};
+    const double y0{origin.y() / form.b};
+    const double dx{direction.x() / form.a};
+    const double dy{direction.y() / form.b};
+    const double sqr_speed{dx * dx + dy * dy};
+    const double s_closest{-(x0 * dx + y0 * dy) / sqr_speed};
+    const double x_closest{x0 + s_closest * dx};
+    const double y_closest{y0 + s_closest * dy};
+    const double distance{std::hypot(x_closest, y_closest)};
+    const double tolerance{precision / std::min(form.a, form.b)};
+
+    if (distance > 1.0 + tolerance) {
+        return;
+    }
+
+    if (distance >= 1.0 - tolerance) {
+        roots.push_back(Root{normalize_angle(std::atan2(y_closest, x_closest)), Intersection_kind::tangent});
+        return;
+    }
+
+    const double half_chord{std::sqrt((1.0 - distance * distance) / sqr_speed)};
+    for (const double s : {s_closest - half_chord, s_closest + half_chord}) {
+        roots.push_back(Root{normalize_angle(std::atan2(y0 + s * dy, x0 + s * dx)), Intersection_kind::transversal});
+    }
+}
+
+// Line crossing of a helix, direction is normalized
+void intersect_helix_and_line(const model3d::Curve& helix,
+    const CurveForm& form,
+    const Vector3d& origin,
+    const Vector3d& direction,
+    double precision,
+    const ParameterRange& helix_range,
+    std::vector<Root>& roots) {
+    const double sqr_radial_speed{direction.x() * direction.x() + direction.y() * direction.y()};
+
+    // Line parallel to the axis: crosses the helix once per turn if it lies on the helix cylinder
+    if (sqr_radial_speed <= math::sqr_precision) {
+        if (std::abs(std::hypot(origin.x(), origin.y()) - form.a) > precision) {
+            return;
+        }
+        const Root root{normalize_angle(std::atan2(origin.y(), origin.x())), Intersection_kind::transversal};
+        add_periodic_roots(root, get_periodic_range(helix_range), roots);
+        return;
+    }
+
+    // Crossings of the line with the helix cylinder, then the turn that passes through the crossing point
+    const double s_closest{-(origin.x() * direction.x() + origin.y() * direction.y()) / sqr_radial_speed};
+    const double distance{std::hypot(origin.x() + s_closest * direction.x(), origin.y() + s_closest * direction.y())};
+    if (distance > form.a + precision) {
+        return;
+    }
+
+    const double half_chord{
+        distance >= form.a - precision ? 0.0 : std::sqrt((form.a * form.a - distance * distance) / sqr_radial_speed)};
+    const std::array<double, 2> crossings{s_closest - half_chord, s_closest + half_chord};
+    const std::size_t crossing_count{half_chord == 0.0 ? 1u : 2u};
+
+    for (std::size_t i{}; i < crossing_count; ++i) {
+        const auto point{origin + direction * crossings[i]};
+        const double angle{std::atan2(point.y(), point.x())};
+        const double t{angle + math::two_pi * std::round((point.z() / form.pitch - angle) / math::two_pi)};
+        if (t < helix_range.min || t > helix_range.max) {
+            continue;
+        }
+
+        const Vector3d helix_point{form.a * std::cos(t), form.a * std::sin(t), form.pitch * t};
+        if ((helix_point - point).get_sqr_magnitude() <= precision * precision) {
+            roots.push_back(Root{t, get_intersection_kind(helix.get_first_derivative(t), direction)});
+        }
+    }
+}
+
+std::size_t intersect_line(const model3d::Curve& curve,
+    const Point3d& origin,
+    const Vector3d& direction,
+    std::vector<PrimitiveHit>& out,
+    double precision,
+    const ParameterRange& helix_range) {
+    const auto& form_opt{get_form(curve)};
+    auto unit_direction{direction};
+    if (!form_opt.has_value() || !unit_direction.normalize()) {
+        return 0;
+    }
+    const auto& form{*form_opt};
+
+    std::vector<Root> roots{};
+    const auto local_origin{form.to_local(origin)};
+    const auto local_direction{form.to_local(unit_direction)};
+    if (form.is_closed()) {
+        intersect_closed_curve_and_line(form, local_origin, local_direction, precision, roots);
+    } else {
+        intersect_helix_and_line(curve, form, local_origin, local_direction, precision, helix_range, roots);
+    }
+
+    const auto first_new{out.size()};
+    add_hits(curve, roots, out);
+    return out.size() - first_new;
+}
+
+} // namespace
+
+std::size_t intersect(const model3d::Curve& curve,
+    const Plane& plane,
+    std::vector<PrimitiveHit>& out,
+    double precision,
+    const ParameterRange& helix_range) {
+    const auto& form_opt{get_form(curve)};
+    auto unit_normal{plane.normal};
+    if (!form_opt.has_value() || !unit_normal.normalize()) {
+        return 0;
+    }
+
+    const auto& equation{get_plane_equation(*form_opt, unit_normal)};
+    const double offset{math::scalar_product(unit_normal, Vector3d{plane.point.data()})};
+
+    std::vector<double> critical_points{};
+    std::vector<Root> roots{};
+    solve_plane_equation(
+        equation, TrigEquation{equation.a, equation.b}, offset, precision, helix_range, critical_points, roots);
+
+    const auto first_new{out.size()};
+    add_hits(curve, roots, out);
+    return out.size() - first_new;
+}
+
+std::size_t intersect(const model3d::Curve& curve,
+    const Line& line,
+    std::vector<PrimitiveHit>& out,
+    double precision,
+    const ParameterRange& helix_range) {
+    return intersect_line(curve, line.origin, line.direction, out, precision, helix_range);
+}
+
+std::size_t intersect(const model3d::Curve& curve,
+    const Ray& ray,
+    std::vector<PrimitiveHit>& out,
+    double precision,
+    const ParameterRange& helix_range) {
+    const auto first_new{out.size()};
+    intersect_line(curve, ray.origin, ray.direction, out, precision, helix_range);
+
+    const double tolerance{precision * ray.direction.get_magnitude()};
+    const auto behind_origin{
+        std::remove_if(out.begin() + static_cast<std::ptrdiff_t>(first_new), out.end(), [&](const PrimitiveHit& hit) {
+            return math::scalar_product(hit.point - ray.origin, ray.direction) < -tolerance;
+        })};
+    out.erase(behind_origin, out.end());
+    return out.size() - first_new;
+}
+
+std::size_t intersect(const model3d::Curve& curve,
+    const Sphere& sphere,
+    std::vector<PrimitiveHit>& out,
+    double precision,
+    const ParameterRange& helix_range) {
+    const auto& form_opt{get_form(curve)};
+    if (!form_opt.has_value() || sphere.radius < 0.0) {
+        return 0;
+    }
+    const auto& form{*form_opt};
+    const auto center_offset{form.to_local(sphere.center)}; // Sphere center in the curve frame
+
+    std::vector<Root> roots{};
+    if (form.is_closed() && form.a == form.b) {
+        // Circle: |P(t) - S|^2 = r_s^2 reduces to A * cos(t) + B * sin(t) = c
+        const double radius{form.a};
+        const TrigEquation trig{-2.0 * radius * center_offset.x(), -2.0 * radius * center_offset.y()};
+        const double c{sphere.radius * sphere.radius - center_offset.get_sqr_magnitude() - radius * radius};
+        trig.solve(c, 2.0 * std::max(sphere.radius, precision) * precision, roots);
+    } else {
+        // Signed distance to the sphere surface, its extrema are found numerically
+        const auto f{[&](double t) {
+            const Vector3d point{form.a * std::cos(t), form.b * std::sin(t), form.pitch * t};
+            return (point - center_offset).get_magnitude() - sphere.radius;
+        }};
+        const auto df{[&](double t) {
+            const Vector3d point{form.a * std::cos(t), form.b * std::sin(t), form.pitch * t};
+            const Vector3d derivative{-form.a * std::sin(t), form.b * std::cos(t), form.pitch};
+            return math::scalar_product(point - center_offset, derivative);
+        }};
+
+        std::vector<ParameterRange> windows{};
+        if (form.is_closed()) {
+            windows.push_back(ParameterRange{0.0, math::two_pi});
+        } else {
+            // Helix: with rho the distance of S from the axis, the radial part of |P(t) - S|^2 is within
+            // [(rho - R)^2, (rho + R)^2], so a root needs (pitch * t - S_n)^2 in
+            // [r_s^2 - (rho + R)^2, r_s^2 - (rho - R)^2].
+            // Only these two narrow slabs of turns are searched, the work follows the turns that can reach
+            // the sphere instead of r_s / pitch. The radius is widened by the precision to keep tangent roots.
+            const double rho{std::hypot(center_offset.x(), center_offset.y())};
+            const double outer{sphere.radius + precision};
+            const double inner{std::max(sphere.radius - precision, 0.0)};
+            const double max_height_sqr{outer * outer - (rho - form.a) * (rho - form.a)};
+            if (max_height_sqr < 0.0) {
+                return 0;
+            }
+            const double max_height{std::sqrt(max_height_sqr)};
+            const double min_height{std::sqrt(std::max(inner * inner - (rho + form.a) * (rho + form.a), 0.0))};
+
+            // Heights between the slabs are strictly inside the sphere: f < 0 there, no root is lost between them
+            const auto add_window{[&](double first_height, double second_height) {
+                double t0{(center_offset.z() + first_height) / form.pitch};
+                double t1{(center_offset.z() + second_height) / form.pitch};
+                if (t0 > t1) {
+                    std::swap(t0, t1);
+                }
+                t0 = std::max(t0, helix_range.min);
+                t1 = std::min(t1, helix_range.max);
+                if (t0 <= t1) {
+                    windows.push_back(ParameterRange{t0, t1});
+                }
+            }};
+            if (min_height > 0.0) {
+                add_window(-max_height, -min_height);
+                add_window(min_height, max_height);
+            } else {
+                add_window(-max_height, max_height);
+            }
+        }
+
+        std::vector<double> critical_points{};
+        for (const auto& window : windows) {
+            critical_points.clear();
+            find_critical_points(df, window.min, window.max, critical_points);
+            find_roots(f, critical_points, window.min, window.max, precision, roots);
+        }
+
+        if (form.is_closed()) {
+            for (auto& root : roots) {
+                root.t = normalize_angle(root.t);
+            }
+        }
+    }
+
+    const auto first_new{out.size()};
+    add_hits(curve, roots, out);
+    return out.size() - first_new;
+}
+
+std::vector<PrimitiveHit> intersect(
+    const model3d::Curve& curve, const Plane& plane, double precision, const ParameterRange& helix_range) {
+    std::vector<PrimitiveHit> result{};
+    intersect(curve, plane, result, precision, helix_range);
+    return result;
+}
+
+std::vector<PrimitiveHit> intersect(
+    const model3d::Curve& curve, const Line& line, double precision, const ParameterRange& helix_range) {
+    std::vector<PrimitiveHit> result{};
+    intersect(curve, line, result, precision, helix_range);
+    return result;
+}
+
+std::vector<PrimitiveHit> intersect(
+    const model3d::Curve& curve, const Ray& ray, double precision, const ParameterRange& helix_range) {
+    std::vector<PrimitiveHit> result{};
+    intersect(curve, ray, result, precision, helix_range);
+    return result;
+}
+
+std::vector<PrimitiveHit> intersect(
+    const model3d::Curve& curve, const Sphere& sphere, double precision, const ParameterRange& helix_range) {
+    std::vector<PrimitiveHit> result{};
+    intersect(curve, sphere, result, precision, helix_range);
+    return result;
+}
+
+std::vector<SliceHit> slice(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    const Vector3d& normal,
+    std::span<const double> offsets,
+    double precision,
+    const ParameterRange& helix_range) {
+    auto unit_normal{normal};
+    if (!unit_normal.normalize()) {
+        return {};
+    }
+    const double offset_scale{1.0 / normal.get_magnitude()};
+
+    std::vector<SliceHit> result{};
+    std::vector<double> critical_points{};
+    std::vector<Root> roots{};
+    std::vector<PrimitiveHit> hits{};
+
+    for (std::size_t curve_index{}; curve_index < curves.size(); ++curve_index) {
+        if (!curves[curve_index]) {
+            continue;
+        }
+        const auto& curve{*curves[curve_index]};
+        const auto& form_opt{get_form(curve)};
+        if (!form_opt.has_value()) {
+            continue;
+        }
+
+        // The curve dependent part of the equation is shared by all parallel planes
+        const auto& equation{get_plane_equation(*form_opt, unit_normal)};
+        const TrigEquation trig{equation.a, equation.b};
+
+        for (std::size_t plane_index{}; plane_index < offsets.size(); ++plane_index) {
+            roots.clear();
+            hits.clear();
+            solve_plane_equation(
+                equation, trig, offsets[plane_index] * offset_scale, precision, helix_range, critical_points, roots);
+            add_hits(curve, roots, hits);
+            for (const auto& hit : hits) {
+                result.push_back(SliceHit{curve_index, plane_index, hit});
+            }
+        }
+    }
+
+    return result;
+}
+
+} // namespace intersection3d
+} // namespace curves
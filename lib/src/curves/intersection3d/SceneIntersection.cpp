@@ -0,0 +1,297 @@
+#include "curves/intersection3d/SceneIntersection.h"
+
+#include "curves/intersection3d/ModelIntersection.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace intersection3d {
+
+namespace {
+
+constexpr std::size_t helices_per_task{16};
+constexpr std::size_t circles_per_leaf{8};
+
+// Circles in structure-of-arrays layout for the broad phase
+struct CircleBounds {
+    std::vector<std::size_t> index;
+    std::vector<const model3d::Circle*> circle;
+    std::vector<double> center_x;
+    std::vector<double> center_y;
+    std::vector<double> center_z;
+    std::vector<double> radius;
+
+    void add(std::size_t curve_index, const model3d::Circle& value) {
+        index.push_back(curve_index);
+        circle.push_back(&value);
+        center_x.push_back(value.get_center().x());
+        center_y.push_back(value.get_center().y());
+        center_z.push_back(value.get_center().z());
+        radius.push_back(value.get_radius());
+    }
+
+    std::size_t size() const { return index.size(); }
+};
+
+// Node of the bounding sphere tree over the circles, a leaf if it has no children.
+// The sphere encloses the bounding spheres (center, radius) of the circles [begin, end).
+struct SphereNode {
+    std::array<double, 3> center;
+    double radius;
+    std::size_t begin;
+    std::size_t end;
+    std::size_t left{};
+    std::size_t right{};
+
+    bool is_leaf() const { return left == 0; };
+};
+
+// Bounding sphere tree, the circles are reordered so that every node covers a contiguous range
+class CircleTree {
+public:
+    explicit CircleTree(CircleBounds&& circles)
+        : _circles{std::move(circles)} {
+        if (_circles.size() > 0) {
+            std::vector<std::size_t> order(_circles.size());
+            std::iota(order.begin(), order.end(), std::size_t{});
+            _nodes.reserve(2 * _circles.size() / circles_per_leaf + 1);
+            build(order, 0, order.size());
+
+            CircleBounds sorted{};
+            for (const auto i : order) {
+                sorted.add(_circles.index[i], *_circles.circle[i]);
+            }
+            _circles = std::move(sorted);
+        }
+    };
+
+    const CircleBounds& get_circles() const { return _circles; };
+    const std::vector<SphereNode>& get_nodes() const { return _nodes; };
+
+private:
+    // Splits at the median of the longest extent of the centers, the sphere of an inner node encloses the two child
+    // spheres
+    std::size_t build(std::vector<std::size_t>& order, std::size_t begin, std::size_t end) {
+        const std::size_t node_index{_nodes.size()};
+        _nodes.push_back(SphereNode{{}, 0.0, begin, end});
+        if (end - begin <= circles_per_leaf) {
+            set_leaf_sphere(order, _nodes[node_index]);
+            return node_index;
+        }
+
+        const std::array<const double*, 3> centers{
+            _circles.center_x.data(), _circles.center_y.data(), _circles.center_z.data()};
+        std::size_t split_axis{};
+        double largest_extent{-1.0};
+        for (std::size_t k{}; k < 3; ++k) {
+            const double* center{centers[k]};
+            double low{center[order[begin]]};
+            double high{low};
+            for (std::size_t i{begin + 1}; i < end; ++i) {
+                const double value{center[order[i]]};
+                low = value < low ? value : low;
+                high = value > high ? value : high;
+            }
+            if (high - low > largest_extent) {
+                largest_extent = high - low;
+                split_axis = k;
+            }
+        }
+
+        const double* key{centers[split_axis]};
+        const std::size_t middle{begin + (end - begin) / 2};
+        std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+            [key](std::size_t first, std::size_t second) { return key[first] < key[second]; });
+
+        const std::size_t left{build(order, begin, middle)};
+        const std::size_t right{build(order, middle, end)};
+        auto& node{_nodes[node_index]};
+        node.left = left;
+        node.right = right;
+        set_enclosing_sphere(_nodes[left], _nodes[right], node);
+        return node_index;
+    };
+
+    void set_leaf_sphere(const std::vector<std::size_t>& order, SphereNode& node) const {
+        std::array<double, 3> low{};
+        std::array<double, 3> high{};
+        for (std::size_t i{node.begin}; i < node.end; ++i) {
+            const auto c{order[i]};
+            const std::array<double, 3> center{_circles.center_x[c], _circles.center_y[c], _circles.center_z[c]};
+            for (std::size_t k{}; k < 3; ++k) {
+                const bool first{i == node.begin};
+                low[k] = first ? center[k] - _circles.radius[c] : std::min(low[k], center[k] - _circles.radius[c]);
+                high[k] = first ? center[k] + _circles.radius[c] : std::max(high[k], center[k] + _circles.radius[c]);
+            }
+        }
+        for (std::size_t k{}; k < 3; ++k) {
+            node.center[k] = 0.5 * (low[k] + high[k]);
+        }
+        for (std::size_t i{node.begin}; i < node.end; ++i) {
+            const auto c{order[i]};
+            const double dx{_circles.center_x[c] - node.center[0]};
+            const double dy{_circles.center_y[c] - node.center[1]};
+            const double dz{_circles.center_z[c] - node.center[2]};
+            node.radius = std::max(node.radius, std::sqrt(dx * dx + dy * dy + dz * dz) + _circles.radius[c]);
+        }
+    };
+
+    // Formula: r = (d + r1 + r2) / 2, C = C1 + (C2 - C1) * (r - r1) / d unless one sphere contains the other
+    static void set_enclosing_sphere(const SphereNode& first, const SphereNode& second, SphereNode& node) {
+        const double dx{second.center[0] - first.center[0]};
+        const double dy{second.center[1] - first.center[1]};
+        const double dz{second.center[2] - first.center[2]};
+        const double distance{std::sqrt(dx * dx + dy * dy + dz * dz)};
+        if (distance + second.radius <= first.radius) {
+            node.center = first.center;
+            node.radius = first.radius;
+        } else if (distance + first.radius <= second.radius) {
+            node.center = second.center;
+            node.radius = second.radius;
+        } else {
+            node.radius = 0.5 * (distance + first.radius + second.radius);
+            const double shift{(node.radius - first.radius) / distance};
+            node.center = {first.center[0] + dx * shift, first.center[1] + dy * shift, first.center[2] + dz * shift};
+        }
+    };
+
+    CircleBounds _circles;
+    std::vector<SphereNode> _nodes;
+};
+
+struct HelixEntry {
+    std::size_t index;
+    const model3d::Helix* helix;
+};
+
+bool is_before(const CurvePairIntersection& first, const CurvePairIntersection& second) {
+    return std::tie(first.first_index, first.second_index, first.hit.t_a) <
+        std::tie(second.first_index, second.second_index, second.hit.t_a);
+}
+
+// Squared distance of a point from the helix axis
+double get_sqr_axis_distance(const model3d::Helix& helix, double x, double y, double z) {
+    const auto& origin{helix.get_center()};
+    const auto& axis{helix.get_axis()};
+    const double dx{x - origin.x()};
+    const double dy{y - origin.y()};
+    const double dz{z - origin.z()};
+    const double along_axis{dx * axis.x() + dy * axis.y() + dz * axis.z()};
+    return std::max(dx * dx + dy * dy + dz * dz - along_axis * along_axis, 0.0);
+}
+
+// A sphere can touch the helix cylinder only if | distance(sphere center, helix axis) - helix radius | <= radius
+bool touches_cylinder(const model3d::Helix& helix, double x, double y, double z, double radius, double precision) {
+    const double reach{radius + precision};
+    const double inner{std::max(helix.get_radius() - reach, 0.0)};
+    const double outer{helix.get_radius() + reach};
+    const double sqr_distance{get_sqr_axis_distance(helix, x, y, z)};
+    return sqr_distance >= inner * inner && sqr_distance <= outer * outer;
+}
+
+// Calls on_candidate with every circle whose bounding sphere touches the helix cylinder.
+// The cylinder is unbounded, so the nodes visited are those along the axis line within the reach of the helix.
+template <typename Callback>
+void find_candidates(const model3d::Helix& helix,
+    const CircleTree& tree,
+    double precision,
+    std::vector<std::size_t>& stack,
+    Callback&& on_candidate) {
+    const auto& nodes{tree.get_nodes()};
+    const auto& circles{tree.get_circles()};
+    stack.clear();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const auto& node{nodes[stack.back()]};
+        stack.pop_back();
+        if (!touches_cylinder(helix, node.center[0], node.center[1], node.center[2], node.radius, precision)) {
+            continue;
+        }
+
+        if (!node.is_leaf()) {
+            stack.push_back(node.right);
+            stack.push_back(node.left);
+            continue;
+        }
+        for (std::size_t c{node.begin}; c < node.end; ++c) {
+            const double x{circles.center_x[c]};
+            const double y{circles.center_y[c]};
+            const double z{circles.center_z[c]};
+            if (touches_cylinder(helix, x, y, z, circles.radius[c], precision)) {
+                on_candidate(c);
+            }
+        }
+    }
+}
+
+} // namespace
+
+std::vector<CurvePairIntersection> find_all_intersections(std::span<const std::shared_ptr<model3d::Curve>> curves,
+    double precision,
+    parallel::Executor& executor,
+    parallel::JobControl* control) {
+    std::vector<HelixEntry> helices{};
+    CircleBounds circles{};
+    for (std::size_t i{}; i < curves.size(); ++i) {
+        if (const auto* helix{dynamic_cast<const model3d::Helix*>(curves[i].get())}) {
+            helices.push_back(HelixEntry{i, helix});
+        } else if (const auto* circle{dynamic_cast<const model3d::Circle*>(curves[i].get())}) {
+            circles.add(i, *circle);
+        }
+    }
+
+    // Helix-circle is currently the only pair type with an intersection solver
+    if (helices.empty() || circles.size() == 0) {
+        return {};
+    }
+
+    const CircleTree tree{std::move(circles)};
+    const auto& sorted_circles{tree.get_circles()};
+    std::vector<std::vector<CurvePairIntersection>> worker_results(executor.get_thread_count());
+    std::atomic<std::size_t> processed_helices{};
+
+    const auto process_helices{[&](std::size_t begin, std::size_t end, std::size_t worker) {
+        auto& results{worker_results[worker]};
+        std::vector<std::size_t> stack{};
+        std::vector<IntersectionHit> hits{};
+
+        for (std::size_t h{begin}; h < end; ++h) {
+            if (control && control->is_cancelled()) {
+                return;
+            }
+
+            const auto& [helix_index, helix]{helices[h]};
+            find_candidates(*helix, tree, precision, stack, [&](std::size_t c) {
+                const auto circle_index{sorted_circles.index[c]};
+                hits.clear();
+                get_intersection_hits(*helix, *sorted_circles.circle[c], hits, precision);
+                for (auto hit : hits) {
+                    if (circle_index < helix_index) {
+                        std::swap(hit.t_a, hit.t_b);
+                    }
+                    results.push_back(CurvePairIntersection{
+                        std::min(helix_index, circle_index), std::max(helix_index, circle_index), hit});
+                }
+            });
+        }
+
+        const auto done{processed_helices.fetch_add(end - begin, std::memory_order_relaxed) + (end - begin)};
+        if (control) {
+            control->report_progress(done, helices.size());
+        }
+    }};
+    executor.parallel_for(helices.size(), helices_per_task, process_helices);
+
+    std::vector<CurvePairIntersection> result{};
+    for (auto& worker_result : worker_results) {
+        result.insert(result.end(), worker_result.begin(), worker_result.end());
+    }
+    std::ranges::sort(result, is_before);
+
+    return result;
+}
+
+} // namespace intersection3d
+} // namespace curves
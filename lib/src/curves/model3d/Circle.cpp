@@ -1,6 +1,8 @@
 #include "curves/model3d/Circle.h"
 
 #include "curves/math/LinearAlgebra.h"
+#include "curves/math/SinCosSequence.h"
+#include "curves/math/VectorExpression.h"
 
 namespace curves {
 namespace model3d {
@@ -20,12 +22,8 @@ Point3d Circle::get_point(double t) const {
     const auto cos{std::cos(t)};
     const auto sin{std::sin(t)};
 
-    const auto offset_u_without_radius{_axis_x * cos}; // cos(t) * U
-    const auto offset_v_without_radius{_axis_y * sin}; // sin(t) * V
-
-    const auto offset_without_radius{offset_u_without_radius + offset_v_without_radius};
-
-    return math::translate(_center, offset_without_radius * _radius);
+    using math::lazy;
+    return lazy(_center) + (lazy(_axis_x) * cos + lazy(_axis_y) * sin) * _radius;
 }
 
 Vector3d Circle::get_first_derivative(double t) const {
@@ -35,11 +33,58 @@ Vector3d Circle::get_first_derivative(double t) const {
     const auto cos{std::cos(t)};
     const auto sin{std::sin(t)};
 
-    const auto offset_v_without_radius{_axis_y * cos}; // cos(t) * V
-    const auto offset_u_without_radius{_axis_x * sin}; // sin(t) * U
+    using math::lazy;
+    return (lazy(_axis_y) * cos - lazy(_axis_x) * sin) * _radius;
+}
+
+CurveEvaluation Circle::evaluate(double t, std::size_t order) const {
+    // Formula: P(t) = C + R * ( cos(t) * U + sin(t) * V )
+    //          P'(t) = R * (cos(t) * V - sin(t) * U)
+    //          P''(t) = -R * ( cos(t) * U + sin(t) * V )
+    // Where U is _axis_x and V is _axis_y
+    // One sin/cos pair for all orders, computed per coordinate without vector temporaries
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    CurveEvaluation result;
+    for (std::size_t i{}; i < 3; ++i) {
+        const double offset{(_axis_x.data()[i] * cos + _axis_y.data()[i] * sin) * _radius};
+        result.point.data()[i] = _center.data()[i] + offset;
+        if (order >= 1) {
+            result.first_derivative.data()[i] = (_axis_y.data()[i] * cos - _axis_x.data()[i] * sin) * _radius;
+        }
+        if (order >= 2) {
+            result.second_derivative.data()[i] = -offset;
+        }
+    }
+    return result;
+}
+
+void Circle::evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const {
+    for (std::size_t i{}; i < t.size(); ++i) {
+        out[i] = Circle::evaluate(t[i], order);
+    }
+}
+
+double Circle::get_max_acceleration() const {
+    // |P''(t)| = R
+    return _radius;
+}
 
-    const auto offset_without_radius{offset_v_without_radius - offset_u_without_radius};
-    return offset_without_radius * _radius;
+void Circle::sample_uniform(double t0, double dt, std::span<Point3d> out) const {
+    // Formula: P(t) = C + (R * U) * cos(t) + (R * V) * sin(t)
+
+    const auto radius_u{_axis_x * _radius};
+    const auto radius_v{_axis_y * _radius};
+
+    math::SinCosSequence sincos{t0, dt};
+    for (auto& point : out) {
+        for (std::size_t i{}; i < 3; ++i) {
+            point.data()[i] = _center.data()[i] + radius_u.data()[i] * sincos.cos() + radius_v.data()[i] * sincos.sin();
+        }
+        sincos.next();
+    }
 }
 
 bool Circle::belongs(const Point3d& point, const double precision) const
@@ -52,5 +97,19 @@ bool Circle::belongs(const Point3d& point, const double precision) const
     return std::abs(get_sqr_distance(point, _center) - ( _radius * _radius)) <= sqr_precision;
 }
 
+double Circle::get_parameter(const Point3d& point) const {
+    // Formula: t = atan2((P - C) * V, (P - C) * U)
+    // Where U is _axis_x and V is _axis_y
+
+    const auto offset{point - _center};
+    const double angle{std::atan2(math::scalar_product(offset, _axis_y), math::scalar_product(offset, _axis_x))};
+    if (angle >= 0.0) {
+        return angle;
+    }
+
+    const double shifted_angle{angle + math::two_pi};
+    return shifted_angle < math::two_pi ? shifted_angle : 0.0; // Tiny negative angles round up to 2pi
+}
+
 } // namespace model3d
 } // namespace curves
\ No newline at end of file
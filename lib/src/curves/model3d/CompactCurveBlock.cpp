@@ -0,0 +1,384 @@
+#include "curves/model3d/CompactCurveBlock.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+using Quaternion = std::array<double, 4>; // {w, x, y, z}
+
+constexpr unsigned component_bits{20};
+constexpr std::uint64_t component_mask{(std::uint64_t{1} << component_bits) - 1};
+constexpr double component_limit{0.70710678118654752}; // 1 / sqrt(2), bound of the three smallest components
+constexpr double code_limit{static_cast<double>(std::numeric_limits<std::uint32_t>::max())};
+
+constexpr std::uint32_t block_magic{0x43435642}; // "CCVB"
+constexpr std::uint32_t block_version{2};
+constexpr std::size_t read_chunk_size{4096}; // Records
+
+struct Frame {
+    Vector3d axis_x;
+    Vector3d axis_y;
+    Vector3d axis;
+};
+
+std::optional<Frame> get_frame(const Curve& curve) {
+    if (const auto circle{dynamic_cast<const Circle*>(&curve)}) {
+        return Frame{circle->get_axis_x(), circle->get_axis_y(), circle->get_axis()};
+    }
+    if (const auto ellipse{dynamic_cast<const Ellipse*>(&curve)}) {
+        return Frame{ellipse->get_axis_x(), ellipse->get_axis_y(), ellipse->get_axis()};
+    }
+    if (const auto helix{dynamic_cast<const Helix*>(&curve)}) {
+        return Frame{helix->get_axis_x(), helix->get_axis_y(), helix->get_axis()};
+    }
+    return std::nullopt;
+}
+
+Quaternion to_quaternion(const Frame& frame) {
+    // Shepperd's method on the rotation matrix with the columns U, V, N:
+    // the square root is taken of the largest of the four candidates, the others follow from the off-diagonals
+    const double m00{frame.axis_x.x()}, m01{frame.axis_y.x()}, m02{frame.axis.x()};
+    const double m10{frame.axis_x.y()}, m11{frame.axis_y.y()}, m12{frame.axis.y()};
+    const double m20{frame.axis_x.z()}, m21{frame.axis_y.z()}, m22{frame.axis.z()};
+    const double trace{m00 + m11 + m22};
+
+    Quaternion q{};
+    if (trace >= m00 && trace >= m11 && trace >= m22) {
+        const double s{2.0 * std::sqrt(1.0 + trace)};
+        q = {0.25 * s, (m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s};
+    } else if (m00 >= m11 && m00 >= m22) {
+        const double s{2.0 * std::sqrt(1.0 + m00 - m11 - m22)};
+        q = {(m21 - m12) / s, 0.25 * s, (m01 + m10) / s, (m02 + m20) / s};
+    } else if (m11 >= m22) {
+        const double s{2.0 * std::sqrt(1.0 + m11 - m00 - m22)};
+        q = {(m02 - m20) / s, (m01 + m10) / s, 0.25 * s, (m12 + m21) / s};
+    } else {
+        const double s{2.0 * std::sqrt(1.0 + m22 - m00 - m11)};
+        q = {(m10 - m01) / s, (m02 + m20) / s, (m12 + m21) / s, 0.25 * s};
+    }
+
+    const double magnitude{std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3])};
+    for (auto& component : q) {
+        component /= magnitude;
+    }
+    return q;
+}
+
+Frame to_frame(const Quaternion& q) {
+    const auto [w, x, y, z]{q};
+    return Frame{Vector3d{1.0 - 2.0 * (y * y + z * z), 2.0 * (x * y + w * z), 2.0 * (x * z - w * y)},
+        Vector3d{2.0 * (x * y - w * z), 1.0 - 2.0 * (x * x + z * z), 2.0 * (y * z + w * x)},
+        Vector3d{2.0 * (x * z + w * y), 2.0 * (y * z - w * x), 1.0 - 2.0 * (x * x + y * y)}};
+}
+
+std::uint64_t encode_quaternion(Quaternion q) {
+    // q and -q are the same rotation: the largest component is made positive and dropped,
+    // it is restored from the unit length
+    std::size_t largest{};
+    for (std::size_t i{1}; i < q.size(); ++i) {
+        if (std::abs(q[i]) > std::abs(q[largest])) {
+            largest = i;
+        }
+    }
+    const double sign{q[largest] < 0.0 ? -1.0 : 1.0};
+
+    std::uint64_t code{static_cast<std::uint64_t>(largest)};
+    for (std::size_t i{}; i < q.size(); ++i) {
+        if (i == largest) {
+            continue;
+        }
+        const double normalized{std::clamp((sign * q[i] + component_limit) / (2.0 * component_limit), 0.0, 1.0)};
+        code = (code << component_bits) | std::llround(normalized * static_cast<double>(component_mask));
+    }
+    return code;
+}
+
+Quaternion decode_quaternion(std::uint64_t code) {
+    const auto largest{static_cast<std::size_t>(code >> (3 * component_bits))};
+
+    Quaternion q{};
+    double sqr_sum{};
+    unsigned shift{3 * component_bits};
+    for (std::size_t i{}; i < q.size(); ++i) {
+        if (i == largest) {
+            continue;
+        }
+        shift -= component_bits;
+        const auto component_code{static_cast<double>((code >> shift) & component_mask)};
+        q[i] = component_code / static_cast<double>(component_mask) * (2.0 * component_limit) - component_limit;
+        sqr_sum += q[i] * q[i];
+    }
+    q[largest] = std::sqrt(std::max(0.0, 1.0 - sqr_sum));
+
+    // Restores the unit length lost to the rounding of the codes
+    const double magnitude{std::sqrt(sqr_sum + q[largest] * q[largest])};
+    for (auto& component : q) {
+        component /= magnitude;
+    }
+    return q;
+}
+
+// Formula: angle = 4 * asin(|q1 - q2| / 2) for unit quaternions with q1 . q2 >= 0, exact also for small angles
+double get_rotation_angle(const Quaternion& first, const Quaternion& second) {
+    double dot{};
+    for (std::size_t i{}; i < first.size(); ++i) {
+        dot += first[i] * second[i];
+    }
+    const double sign{dot < 0.0 ? -1.0 : 1.0};
+
+    double sqr_distance{};
+    for (std::size_t i{}; i < first.size(); ++i) {
+        const double difference{first[i] - sign * second[i]};
+        sqr_distance += difference * difference;
+    }
+    return 4.0 * std::asin(std::min(0.5 * std::sqrt(sqr_distance), 1.0));
+}
+
+std::uint32_t quantize(double value, double step) {
+    return static_cast<std::uint32_t>(std::llround(value / step));
+}
+
+template <typename T>
+void write_value(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+CompactCurveBlock::CompactCurveBlock(
+    const Point3d& origin, double center_step, double size_step, double max_error, double frame_error)
+    : _origin{origin}, _center_step{center_step}, _size_step{size_step}, _max_error{max_error},
+      _frame_error{frame_error} {};
+
+std::optional<CompactCurveBlock> CompactCurveBlock::encode(
+    std::span<const std::shared_ptr<Curve>> curves, double max_error) {
+    if (!(max_error > 0.0)) {
+        return std::nullopt;
+    }
+
+    struct Parameters {
+        Point3d center;
+        double size_a;
+        double size_b;
+        CurveFactory::Curve_type type;
+    };
+
+    std::vector<Parameters> parameters;
+    parameters.reserve(curves.size());
+    for (const auto& curve : curves) {
+        if (const auto circle{dynamic_cast<const Circle*>(curve.get())}) {
+            parameters.push_back(
+                {circle->get_center(), circle->get_radius(), 0.0, CurveFactory::Curve_type::circle});
+        } else if (const auto ellipse{dynamic_cast<const Ellipse*>(curve.get())}) {
+            parameters.push_back({ellipse->get_center(),
+                ellipse->get_radius_major(),
+                ellipse->get_radius_minor(),
+                CurveFactory::Curve_type::ellipse});
+        } else if (const auto helix{dynamic_cast<const Helix*>(curve.get())}) {
+            parameters.push_back(
+                {helix->get_center(), helix->get_radius(), helix->get_step(), CurveFactory::Curve_type::helix});
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    // Bounding box of the centers
+    std::array<double, 3> min{};
+    std::array<double, 3> max{};
+    min.fill(std::numeric_limits<double>::infinity());
+    max.fill(-std::numeric_limits<double>::infinity());
+    double max_size{};
+    for (const auto& item : parameters) {
+        for (std::size_t axis{}; axis < 3; ++axis) {
+            min[axis] = std::min(min[axis], item.center.data()[axis]);
+            max[axis] = std::max(max[axis], item.center.data()[axis]);
+        }
+        max_size = std::max({max_size, item.size_a, item.size_b});
+    }
+    if (parameters.empty()) {
+        min.fill(0.0);
+        max.fill(0.0);
+    }
+
+    // Rounding to the nearest code: the error per coordinate is half a step,
+    // for the center as a whole sqrt(3) / 2 of a step
+    const double center_step{2.0 * max_error / std::sqrt(3.0)};
+    const double size_step{2.0 * max_error};
+    for (std::size_t axis{}; axis < 3; ++axis) {
+        if (!std::isfinite(max[axis] - min[axis]) || (max[axis] - min[axis]) / center_step > code_limit) {
+            return std::nullopt;
+        }
+    }
+    if (!std::isfinite(max_size) || max_size / size_step > code_limit) {
+        return std::nullopt;
+    }
+
+    CompactCurveBlock block{Point3d{min}, center_step, size_step, max_error, 0.0};
+    block._curves.reserve(parameters.size());
+    for (std::size_t i{}; i < parameters.size(); ++i) {
+        const auto& item{parameters[i]};
+        const auto offset{item.center - block._origin};
+        const auto rotation{to_quaternion(*get_frame(*curves[i]))};
+        const auto frame{encode_quaternion(rotation)};
+        block._frame_error = std::max(block._frame_error, get_rotation_angle(rotation, decode_quaternion(frame)));
+
+        block._curves.push_back({frame,
+            {quantize(offset.x(), center_step), quantize(offset.y(), center_step), quantize(offset.z(), center_step)},
+            quantize(item.size_a, size_step),
+            quantize(item.size_b, size_step),
+            static_cast<std::uint8_t>(item.type),
+            {}});
+    }
+    return block;
+}
+
+CompactCurveBlock::Decoded_curve CompactCurveBlock::decode_parameters(std::size_t index) const {
+    const auto& curve{_curves[index]};
+    const auto frame{to_frame(decode_quaternion(curve.frame))};
+
+    const Vector3d offset{static_cast<double>(curve.center[0]) * _center_step,
+        static_cast<double>(curve.center[1]) * _center_step,
+        static_cast<double>(curve.center[2]) * _center_step};
+
+    return Decoded_curve{math::translate(_origin, offset),
+        static_cast<double>(curve.size_a) * _size_step,
+        static_cast<double>(curve.size_b) * _size_step,
+        frame.axis_x,
+        frame.axis_y,
+        frame.axis};
+}
+
+Point3d CompactCurveBlock::get_point(std::size_t index, double t) const {
+    // Formula: P(t) = C + a * cos(t) * U + b * sin(t) * V (+ (h * t / 2pi) * N for a helix)
+    // Where a = b = R for a circle and a helix
+    const auto curve{decode_parameters(index)};
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        return math::translate(curve.center, (curve.axis_x * cos + curve.axis_y * sin) * curve.size_a);
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        const auto offset{curve.axis_x * (curve.size_a * cos) + curve.axis_y * (curve.size_b * sin)};
+        return math::translate(curve.center, offset);
+    }
+    case CurveFactory::Curve_type::helix: {
+        const auto offset_n{curve.axis * (curve.size_b * t / math::two_pi)};
+        return math::translate(curve.center, (curve.axis_x * cos + curve.axis_y * sin) * curve.size_a + offset_n);
+    }
+    default: {
+        return curve.center;
+    }
+    }
+}
+
+Vector3d CompactCurveBlock::get_first_derivative(std::size_t index, double t) const {
+    // Formula: P'(t) = b * cos(t) * V - a * sin(t) * U (+ (h / 2pi) * N for a helix)
+    const auto curve{decode_parameters(index)};
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        return (curve.axis_y * cos - curve.axis_x * sin) * curve.size_a;
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        return curve.axis_y * (curve.size_b * cos) - curve.axis_x * (curve.size_a * sin);
+    }
+    case CurveFactory::Curve_type::helix: {
+        const auto offset_n{curve.axis * (curve.size_b / math::two_pi)};
+        return (curve.axis_y * cos - curve.axis_x * sin) * curve.size_a + offset_n;
+    }
+    default: {
+        return Vector3d{0.0, 0.0, 0.0};
+    }
+    }
+}
+
+std::shared_ptr<Curve> CompactCurveBlock::decode(std::size_t index) const {
+    const auto curve{decode_parameters(index)};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        auto result{CurveFactory::try_create_circle(curve.center, curve.size_a, curve.axis, curve.axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        auto result{CurveFactory::try_create_ellipse(
+            curve.center, curve.size_a, curve.size_b, curve.axis, curve.axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    case CurveFactory::Curve_type::helix: {
+        auto result{CurveFactory::try_create_helix(
+            curve.center, curve.size_a, curve.size_b, curve.axis, curve.axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    default: {
+        return nullptr;
+    }
+    }
+}
+
+void CompactCurveBlock::write(std::ostream& os) const {
+    write_value(os, block_magic);
+    write_value(os, block_version);
+    write_value(os, _origin.data());
+    write_value(os, _center_step);
+    write_value(os, _size_step);
+    write_value(os, _max_error);
+    write_value(os, _frame_error);
+    write_value(os, static_cast<std::uint64_t>(_curves.size()));
+    os.write(reinterpret_cast<const char*>(_curves.data()),
+        static_cast<std::streamsize>(_curves.size() * sizeof(CompactCurve)));
+}
+
+std::optional<CompactCurveBlock> CompactCurveBlock::read(std::istream& is) {
+    std::uint32_t magic{};
+    std::uint32_t version{};
+    std::array<double, 3> origin{};
+    double center_step{};
+    double size_step{};
+    double max_error{};
+    double frame_error{};
+    std::uint64_t count{};
+    if (!read_value(is, magic) || magic != block_magic || !read_value(is, version) || version != block_version ||
+        !read_value(is, origin) || !read_value(is, center_step) || !read_value(is, size_step) ||
+        !read_value(is, max_error) || !read_value(is, frame_error) || !read_value(is, count)) {
+        return std::nullopt;
+    }
+
+    CompactCurveBlock block{Point3d{origin}, center_step, size_step, max_error, frame_error};
+    while (block._curves.size() < count) {
+        const std::size_t begin{block._curves.size()};
+        const auto chunk_size{static_cast<std::size_t>(std::min<std::uint64_t>(count - begin, read_chunk_size))};
+        block._curves.resize(begin + chunk_size);
+        if (!is.read(reinterpret_cast<char*>(block._curves.data() + begin),
+                static_cast<std::streamsize>(chunk_size * sizeof(CompactCurve)))) {
+            return std::nullopt;
+        }
+    }
+    for (const auto& curve : block._curves) {
+        if (curve.type >= static_cast<std::uint8_t>(CurveFactory::Curve_type::size)) {
+            return std::nullopt;
+        }
+    }
+    return block;
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,102 @@
+#include "curves/model3d/CreationResult.h"
+
+namespace curves {
+namespace model3d {
+
+const char* to_string(Creation_error error) {
+    switch (error) {
+    case Creation_error::none: {
+        return "none";
+    }
+    case Creation_error::invalid_radius: {
+        return "invalid_radius";
+    }
+    case Creation_error::invalid_semi_axes: {
+        return "invalid_semi_axes";
+    }
+    case Creation_error::invalid_helix_parameters: {
+        return "invalid_helix_parameters";
+    }
+    case Creation_error::degenerate_normal: {
+        return "degenerate_normal";
+    }
+    case Creation_error::degenerate_direction: {
+        return "degenerate_direction";
+    }
+    case Creation_error::non_perpendicular_frame: {
+        return "non_perpendicular_frame";
+    }
+    case Creation_error::mismatched_batch_sizes: {
+        return "mismatched_batch_sizes";
+    }
+    case Creation_error::invalid_curve_type: {
+        return "invalid_curve_type";
+    }
+    default: {
+        return "unknown";
+    }
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const CreationFailure& failure) {
+    const auto& values{failure.values};
+    switch (failure.error) {
+    case Creation_error::invalid_radius: {
+        return os << "Invalid radius: " << values[0];
+    }
+    case Creation_error::invalid_semi_axes: {
+        return os << "Invalid semi-axis lengths: " << values[0] << " : " << values[1];
+    }
+    case Creation_error::invalid_helix_parameters: {
+        return os << "Invalid helix parameters: radius = " << values[0] << ", step = " << values[1];
+    }
+    case Creation_error::degenerate_normal: {
+        return os << "Invalid plane_normal or axis: {" << values[0] << ", " << values[1] << ", " << values[2] << '}';
+    }
+    case Creation_error::degenerate_direction: {
+        return os << "Invalid start direction: {" << values[0] << ", " << values[1] << ", " << values[2] << '}';
+    }
+    case Creation_error::non_perpendicular_frame: {
+        return os << "The normal and the start direction must be perpendicular, scalar product: " << values[0];
+    }
+    case Creation_error::mismatched_batch_sizes: {
+        return os << "Batch arrays of different lengths: " << values[0] << " to " << values[1];
+    }
+    case Creation_error::invalid_curve_type: {
+        return os << "Invalid curve type: " << values[0];
+    }
+    default: {
+        return os << to_string(failure.error);
+    }
+    }
+}
+
+void CreationStats::record(Creation_error error) {
+    const auto index{static_cast<std::size_t>(error)};
+    if (index < _counts.size()) {
+        ++_counts[index];
+    }
+}
+
+std::size_t CreationStats::get_count(Creation_error error) const {
+    const auto index{static_cast<std::size_t>(error)};
+    return index < _counts.size() ? _counts[index] : 0;
+}
+
+std::size_t CreationStats::get_total_count() const {
+    return std::accumulate(_counts.begin(), _counts.end(), std::size_t{});
+}
+
+std::size_t CreationStats::get_failure_count() const {
+    return get_total_count() - get_count(Creation_error::none);
+}
+
+CreationStats& CreationStats::operator+=(const CreationStats& other) {
+    for (std::size_t i{}; i < _counts.size(); ++i) {
+        _counts[i] += other._counts[i];
+    }
+    return *this;
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,70 @@
+#include "curves/model3d/Curve.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+#include "curves/model3d/CurveEvaluation.h"
+
+namespace curves {
+namespace model3d {
+
+Curve::Curve() : _id{generate_id()} {};
+
+Curve::Curve(const Curve&) : _id{generate_id()} {};
+
+Curve& Curve::operator=(const Curve&) {
+    _id = generate_id();
+    return *this;
+}
+
+CurveEvaluation Curve::evaluate(double t, std::size_t order) const {
+    CurveEvaluation result;
+    result.point = get_point(t);
+    if (order >= 1) {
+        result.first_derivative = get_first_derivative(t);
+    }
+    if (order >= 2) {
+        // Central difference, step balancing truncation and rounding errors
+        const double step{std::cbrt(std::numeric_limits<double>::epsilon()) * std::max(1.0, std::abs(t))};
+        const auto difference{get_first_derivative(t + step) - get_first_derivative(t - step)};
+        result.second_derivative = difference / (2.0 * step);
+    }
+    return result;
+}
+
+void Curve::evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const {
+    for (std::size_t i{}; i < t.size(); ++i) {
+        out[i] = evaluate(t[i], order);
+    }
+}
+
+void Curve::sample_uniform(double t0, double dt, std::span<Point3d> out) const {
+    for (std::size_t i{}; i < out.size(); ++i) {
+        out[i] = get_point(t0 + static_cast<double>(i) * dt);
+    }
+}
+
+double Curve::get_max_acceleration() const {
+    // |P'(t + h) - P'(t)| / h is the length of the mean of P'' over [t, t + h], so it does not exceed the maximum;
+    // the margin covers the maximum falling between two samples
+    constexpr std::size_t samples{256};
+    constexpr double margin{1.1};
+    const double step{math::two_pi / static_cast<double>(samples)};
+
+    double result{};
+    auto previous{get_first_derivative(0.0)};
+    for (std::size_t i{1}; i <= samples; ++i) {
+        const auto current{get_first_derivative(static_cast<double>(i) * step)};
+        result = std::max(result, (current - previous).get_magnitude() / step);
+        previous = current;
+    }
+    return margin * result;
+}
+
+std::uint64_t Curve::generate_id() {
+    static std::atomic<std::uint64_t> next_id{1};
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace model3d
+} // namespace curves
@@ -1,48 +1,168 @@
 #include "curves/model3d/CurveFactory.h"
 
 #include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
 #include "curves/math/Point.h"
 #include "curves/math/Vector.h"
 #include "curves/model3d/Circle.h"
 #include "curves/model3d/Ellipse.h"
 #include "curves/model3d/Helix.h"
+#include "curves/model3d/MemoryUsage.h"
+#include "curves/parallel/Trace.h"
 
 namespace curves {
 namespace model3d {
 
-std::shared_ptr<Curve> CurveFactory::create_random_curve(bool log_error) {
-    return create_random_curve_by_type(random_curve_type(), log_error);
+namespace {
+
+CreationFailure make_failure(Creation_error error, double first, double second = 0.0) {
+    return CreationFailure{error, {first, second, 0.0}};
 }
 
-std::shared_ptr<Curve> CurveFactory::create_random_curve_by_type(Curve_type curve_type, bool log_error) {
-    switch (curve_type) {
-    case Curve_type::circle: {
-        return create_random_circle(log_error);
-    }
-    case Curve_type::ellipse: {
-        return create_random_ellipse(log_error);
+CreationFailure make_failure(Creation_error error, const Vector3d& vector) {
+    return CreationFailure{error, vector.data()};
+}
+
+template <typename T>
+CreationResult<std::shared_ptr<Curve>> to_curve_result(CreationResult<std::shared_ptr<T>>&& result) {
+    if (!result.has_value()) {
+        return result.failure();
     }
-    case Curve_type::helix: {
-        return create_random_helix(log_error);
+    return std::shared_ptr<Curve>{std::move(result).value()};
+}
+
+// Normalizes the frame in place. Both vectors must be non-degenerate and perpendicular to each other.
+std::optional<CreationFailure> normalize_frame(Vector3d& normal, Vector3d& direction) {
+    if (!normal.normalize()) {
+        return make_failure(Creation_error::degenerate_normal, normal);
     }
-    default: {
-        return nullptr;
+
+    if (!direction.normalize()) {
+        return make_failure(Creation_error::degenerate_direction, direction);
     }
+
+    if (!math::are_perpendicular(normal, direction)) {
+        return make_failure(Creation_error::non_perpendicular_frame, math::scalar_product(normal, direction));
     }
+
+    return std::nullopt;
 }
 
-std::shared_ptr<Circle> CurveFactory::create_circle(
-    const Point3d& center, double radius, const Vector3d& plane_normal, bool log_error) {
-    const auto& start_direction_opt{plane_normal.get_any_perpendicular()};
-    if (!start_direction_opt.has_value()) {
-        if (log_error) {
-            std::cout << "Error: Failed to obtain start direction.\n";
+// Normalized frames of a batch, structure-of-arrays layout
+struct BatchFrames {
+    std::vector<double> normal_x;
+    std::vector<double> normal_y;
+    std::vector<double> normal_z;
+    std::vector<double> direction_x;
+    std::vector<double> direction_y;
+    std::vector<double> direction_z;
+
+    void resize(std::size_t size) {
+        for (auto* coords : {&normal_x, &normal_y, &normal_z, &direction_x, &direction_y, &direction_z}) {
+            coords->resize(size);
         }
-        return nullptr;
     }
-    const auto& start_direction{*start_direction_opt};
 
-    return create_circle(center, radius, plane_normal, start_direction, log_error);
+    Vector3d get_normal(std::size_t i) const { return Vector3d{normal_x[i], normal_y[i], normal_z[i]}; }
+    Vector3d get_direction(std::size_t i) const { return Vector3d{direction_x[i], direction_y[i], direction_z[i]}; }
+};
+
+// Scratch buffers are kept per thread so that repeated batches do not allocate
+thread_local BatchFrames batch_frames{};
+
+Point3d get_batch_point(const BatchVectors& points, std::size_t i) {
+    return Point3d{points.x[i], points.y[i], points.z[i]};
+}
+
+// Writes the normalized vectors to out_*, marks degenerate ones with the given error. Output may alias the input.
+void normalize_batch_vectors(std::span<Creation_error> status,
+    std::span<const double> x,
+    std::span<const double> y,
+    std::span<const double> z,
+    Creation_error error,
+    std::span<double> out_x,
+    std::span<double> out_y,
+    std::span<double> out_z) {
+    // Same arithmetic as Vector::get_sqr_magnitude and Vector::normalize, so the batch produces
+    // exactly the same frames as the single-curve path
+    for (std::size_t i{}; i < status.size(); ++i) {
+        const double sqr_magnitude{x[i] * x[i] + y[i] * y[i] + z[i] * z[i]};
+        const bool degenerate{sqr_magnitude <= math::sqr_precision};
+        const double magnitude{degenerate ? 1.0 : std::sqrt(sqr_magnitude)};
+        status[i] = (status[i] == Creation_error::none && degenerate) ? error : status[i];
+        out_x[i] = x[i] / magnitude;
+        out_y[i] = y[i] / magnitude;
+        out_z[i] = z[i] / magnitude;
+    }
+}
+
+// Normalizes the normals (axes) of the batch, marks degenerate ones
+void normalize_batch_normals(const BatchVectors& normals, std::span<Creation_error> status, BatchFrames& frames) {
+    frames.resize(status.size());
+    normalize_batch_vectors(status, normals.x, normals.y, normals.z, Creation_error::degenerate_normal, frames.normal_x,
+        frames.normal_y, frames.normal_z);
+}
+
+// Derives normalized start directions from the raw normals and checks the frames
+void build_batch_directions(const BatchVectors& normals, std::span<Creation_error> status, BatchFrames& frames) {
+    const auto size{status.size()};
+
+    // Same choice as Vector::get_any_perpendicular: cross product with the basis vector
+    // of the smallest (first one in case of ties) absolute component
+    for (std::size_t i{}; i < size; ++i) {
+        const double x{normals.x[i]};
+        const double y{normals.y[i]};
+        const double z{normals.z[i]};
+        const bool use_y{std::abs(y) < std::abs(x)};
+        const bool use_z{std::abs(z) < (use_y ? std::abs(y) : std::abs(x))};
+        const double basis_x{(!use_y && !use_z) ? 1.0 : 0.0};
+        const double basis_y{(use_y && !use_z) ? 1.0 : 0.0};
+        const double basis_z{use_z ? 1.0 : 0.0};
+        frames.direction_x[i] = y * basis_z - z * basis_y;
+        frames.direction_y[i] = z * basis_x - x * basis_z;
+        frames.direction_z[i] = x * basis_y - y * basis_x;
+    }
+
+    normalize_batch_vectors(status, frames.direction_x, frames.direction_y, frames.direction_z,
+        Creation_error::degenerate_direction, frames.direction_x, frames.direction_y, frames.direction_z);
+
+    for (std::size_t i{}; i < size; ++i) {
+        const double scalar_product{frames.normal_x[i] * frames.direction_x[i] +
+            frames.normal_y[i] * frames.direction_y[i] + frames.normal_z[i] * frames.direction_z[i]};
+        const bool perpendicular{std::abs(scalar_product) <= math::sqr_precision};
+        status[i] =
+            (status[i] == Creation_error::none && !perpendicular) ? Creation_error::non_perpendicular_frame : status[i];
+    }
+}
+
+// A batch whose arrays differ in length is not truncated to the shortest one: every item fails
+template <typename T, typename Input>
+bool reject_mismatched_sizes(const Input& input, CurveBatch<T>& output) {
+    if (input.get_min_size() == input.size()) {
+        return false;
+    }
+    output.curves.clear();
+    output.status.assign(input.size(), Creation_error::mismatched_batch_sizes);
+    output.stats = CreationStats{};
+    for (std::size_t i{}; i < input.size(); ++i) {
+        output.stats.record(Creation_error::mismatched_batch_sizes);
+    }
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<Curve> CurveFactory::create_random_curve(bool log_error) {
+    return create_random_curve_by_type(random_curve_type(), log_error);
+}
+
+std::shared_ptr<Curve> CurveFactory::create_random_curve_by_type(Curve_type curve_type, bool log_error) {
+    return unwrap(try_create_random_curve_by_type(curve_type), log_error);
+}
+
+std::shared_ptr<Circle> CurveFactory::create_circle(
+    const Point3d& center, double radius, const Vector3d& plane_normal, bool log_error) {
+    return unwrap(try_create_circle(center, radius, plane_normal), log_error);
 }
 
 std::shared_ptr<Circle> CurveFactory::create_circle(const Point3d& center,
@@ -50,175 +170,190 @@ std::shared_ptr<Circle> CurveFactory::create_circle(const Point3d& center,
     const Vector3d& plane_normal,
     const Vector3d& start_direction,
     bool log_error) {
+    return unwrap(try_create_circle(center, radius, plane_normal, start_direction), log_error);
+}
+
+std::shared_ptr<Circle> CurveFactory::create_random_circle(bool log_error) {
+    parallel::TraceSpan span{"CurveFactory::create_random_circle"};
+    return unwrap(try_create_random_circle(), log_error);
+}
 
+std::shared_ptr<Ellipse> CurveFactory::create_ellipse(
+    const Point3d& center, double radius_major, double radius_minor, const Vector3d& plane_normal, bool log_error) {
+    return unwrap(try_create_ellipse(center, radius_major, radius_minor, plane_normal), log_error);
+}
+
+std::shared_ptr<Ellipse> CurveFactory::create_ellipse(const Point3d& center,
+    double radius_major,
+    double radius_minor,
+    const Vector3d& plane_normal,
+    const Vector3d& major_direction,
+    bool log_error) {
+    return unwrap(try_create_ellipse(center, radius_major, radius_minor, plane_normal, major_direction), log_error);
+}
+
+std::shared_ptr<Ellipse> CurveFactory::create_random_ellipse(bool log_error) {
+    parallel::TraceSpan span{"CurveFactory::create_random_ellipse"};
+    return unwrap(try_create_random_ellipse(), log_error);
+}
+
+std::shared_ptr<Helix> CurveFactory::create_helix(const Point3d& center, double radius, double step, bool log_error) {
+    return unwrap(try_create_helix(center, radius, step), log_error);
+}
+
+std::shared_ptr<Helix> CurveFactory::create_helix(
+    const Point3d& center, double radius, double step, const Vector3d& axis, bool log_error) {
+    return unwrap(try_create_helix(center, radius, step, axis), log_error);
+}
+
+std::shared_ptr<Helix> CurveFactory::create_helix(const Point3d& center,
+    double radius,
+    double step,
+    const Vector3d& axis,
+    const Vector3d& start_direction,
+    bool log_error) {
+    return unwrap(try_create_helix(center, radius, step, axis, start_direction), log_error);
+}
+
+std::shared_ptr<Helix> CurveFactory::create_random_helix(bool log_error) {
+    parallel::TraceSpan span{"CurveFactory::create_random_helix"};
+    return unwrap(try_create_random_helix(), log_error);
+}
+
+CreationResult<std::shared_ptr<Circle>> CurveFactory::try_create_circle(
+    const Point3d& center, double radius, const Vector3d& plane_normal) {
+    const auto& start_direction_opt{plane_normal.get_any_perpendicular()};
+    if (!start_direction_opt.has_value()) {
+        return make_failure(Creation_error::degenerate_normal, plane_normal);
+    }
+
+    return try_create_circle(center, radius, plane_normal, *start_direction_opt);
+}
+
+CreationResult<std::shared_ptr<Circle>> CurveFactory::try_create_circle(
+    const Point3d& center, double radius, const Vector3d& plane_normal, const Vector3d& start_direction) {
+    parallel::TraceSpan span{"CurveFactory::try_create_circle"};
     // From a mathematical point of view, the radius can be zero (degenerate case: the circle collapses to a point),
     // but in this context a zero or negative radius is considered invalid.
     if (radius <= math::precision) {
-        if (log_error) {
-            std::cout << "Error: Invalid radius: " << radius << '\n';
-        }
-        return nullptr;
+        return make_failure(Creation_error::invalid_radius, radius);
     }
 
     auto normalized_plane_normal{plane_normal};
-    if (!normalized_plane_normal.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid plane_normal: " << plane_normal << '\n';
-        }
-        return nullptr;
-    }
-
     auto normalized_start_direction{start_direction};
-    if (!normalized_start_direction.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid start_direction: " << start_direction << '\n';
-        }
-        return nullptr;
-    }
-
-    if (!math::are_perpendicular(normalized_plane_normal, normalized_start_direction)) {
-        if (log_error) {
-            std::cout << "Error: The plane_normal and the start direction must be perpendicular.\n";
-        }
-        return nullptr;
+    if (const auto& failure_opt{normalize_frame(normalized_plane_normal, normalized_start_direction)}) {
+        return *failure_opt;
     }
 
-    return std::shared_ptr<Circle>{new Circle(center, radius, normalized_plane_normal, normalized_start_direction)};
+    return make_curve<Circle>(center, radius, normalized_plane_normal, normalized_start_direction);
 }
 
-std::shared_ptr<Circle> CurveFactory::create_random_circle(bool log_error) {
-    constexpr auto min_radius{math::precision};
-    constexpr auto max_radius{999999.9};
-
-    const auto center{random_point()};
-    const auto radius{random_double(min_radius, max_radius)};
-    const auto plane_normal{random_vector()};
-    return create_circle(center, radius, plane_normal, log_error);
-}
-
-std::shared_ptr<Ellipse> CurveFactory::create_ellipse(
-    const Point3d& center, double radius_major, double radius_minor, const Vector3d& plane_normal, bool log_error) {
+CreationResult<std::shared_ptr<Ellipse>> CurveFactory::try_create_ellipse(
+    const Point3d& center, double radius_major, double radius_minor, const Vector3d& plane_normal) {
     const auto& major_direction_opt{plane_normal.get_any_perpendicular()};
     if (!major_direction_opt.has_value()) {
-        if (log_error) {
-            std::cout << "Error: Failed to obtain major_direction.\n";
-        }
-        return nullptr;
+        return make_failure(Creation_error::degenerate_normal, plane_normal);
     }
-    const auto& major_direction{*major_direction_opt};
 
-    return create_ellipse(center, radius_major, radius_minor, plane_normal, major_direction, log_error);
+    return try_create_ellipse(center, radius_major, radius_minor, plane_normal, *major_direction_opt);
 }
 
-std::shared_ptr<Ellipse> CurveFactory::create_ellipse(const Point3d& center,
+CreationResult<std::shared_ptr<Ellipse>> CurveFactory::try_create_ellipse(const Point3d& center,
     double radius_major,
     double radius_minor,
     const Vector3d& plane_normal,
-    const Vector3d& major_direction,
-    bool log_error) {
+    const Vector3d& major_direction) {
+    parallel::TraceSpan span{"CurveFactory::try_create_ellipse"};
     // From a mathematical point of view, one or both semi-axes may be zero
     // (degenerate cases: the ellipse collapses to a line segment or a point).
     // However, in this context zero or negative semi-axis values are considered invalid.
     if (radius_major <= math::precision || radius_minor <= math::precision) {
-        if (log_error) {
-            std::cout << "Error: Invalid semi-axis lengths: " << radius_major << " : " << radius_minor << '\n';
-        }
-        return nullptr;
+        return make_failure(Creation_error::invalid_semi_axes, radius_major, radius_minor);
     }
 
     auto normalized_plane_normal{plane_normal};
-    if (!normalized_plane_normal.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid plane_normal: " << plane_normal << '\n';
-        }
-        return nullptr;
-    }
-
     auto normalized_major_direction{major_direction};
-    if (!normalized_major_direction.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid major_direction: " << major_direction << '\n';
-        }
-        return nullptr;
+    if (const auto& failure_opt{normalize_frame(normalized_plane_normal, normalized_major_direction)}) {
+        return *failure_opt;
     }
 
-    if (!math::are_perpendicular(normalized_plane_normal, normalized_major_direction)) {
-        if (log_error) {
-            std::cout << "Error: The plane_normal and the major_direction must be perpendicular.\n";
-        }
-        return nullptr;
-    }
-
-    return std::shared_ptr<Ellipse>{
-        new Ellipse(center, radius_major, radius_minor, normalized_plane_normal, normalized_major_direction)};
+    return make_curve<Ellipse>(
+        center, radius_major, radius_minor, normalized_plane_normal, normalized_major_direction);
 }
 
-std::shared_ptr<Ellipse> CurveFactory::create_random_ellipse(bool log_error) {
-    constexpr auto min_radius{math::precision};
-    constexpr auto max_radius{999999.9};
-
-    const auto center{random_point()};
-    const auto radius_major{random_double(min_radius, max_radius)};
-    const auto radius_minor{random_double(min_radius, max_radius)};
-    const auto plane_normal{random_vector()};
-    return create_ellipse(center, radius_major, radius_minor, plane_normal, log_error);
-}
-
-std::shared_ptr<Helix> CurveFactory::create_helix(const Point3d& center, double radius, double step, bool log_error) {
-
-    return create_helix(center, radius, step, Vector3d{0.0, 0.0, 1.0}, log_error);
+CreationResult<std::shared_ptr<Helix>> CurveFactory::try_create_helix(
+    const Point3d& center, double radius, double step) {
+    return try_create_helix(center, radius, step, Vector3d{0.0, 0.0, 1.0});
 }
 
-std::shared_ptr<Helix> CurveFactory::create_helix(
-    const Point3d& center, double radius, double step, const Vector3d& axis, bool log_error) {
+CreationResult<std::shared_ptr<Helix>> CurveFactory::try_create_helix(
+    const Point3d& center, double radius, double step, const Vector3d& axis) {
     const auto& start_direction_opt{axis.get_any_perpendicular()};
     if (!start_direction_opt.has_value()) {
-        if (log_error) {
-            std::cout << "Error: Failed to obtain start direction.\n";
-        }
-        return nullptr;
+        return make_failure(Creation_error::degenerate_normal, axis);
     }
-    const auto& start_direction{*start_direction_opt};
 
-    return create_helix(center, radius, step, axis, start_direction, log_error);
+    return try_create_helix(center, radius, step, axis, *start_direction_opt);
 }
 
-std::shared_ptr<Helix> CurveFactory::create_helix(const Point3d& center,
-    double radius,
-    double step,
-    const Vector3d& axis,
-    const Vector3d& start_direction,
-    bool log_error) {
+CreationResult<std::shared_ptr<Helix>> CurveFactory::try_create_helix(
+    const Point3d& center, double radius, double step, const Vector3d& axis, const Vector3d& start_direction) {
+    parallel::TraceSpan span{"CurveFactory::try_create_helix"};
     // From a mathematical point of view, the radius or step could be zero
     // (degenerate case: the helix collapses to a straight line along the axis or a single point).
     // However, in this context zero or negative values are considered invalid.
     if (radius <= math::precision || step <= math::precision) {
-        if (log_error) {
-            std::cout << "Error: Invalid helix parameters: radius = " << radius << ", step = " << step << '\n';
-        }
-        return nullptr;
+        return make_failure(Creation_error::invalid_helix_parameters, radius, step);
     }
 
     auto normalized_axis{axis};
-    if (!normalized_axis.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid axis: " << axis << '\n';
-        }
-        return nullptr;
+    auto normalized_start_direction{start_direction};
+    if (const auto& failure_opt{normalize_frame(normalized_axis, normalized_start_direction)}) {
+        return *failure_opt;
     }
 
-    auto normalized_start_direction{start_direction};
-    if (!normalized_start_direction.normalize()) {
-        if (log_error) {
-            std::cout << "Error: Invalid start_direction: " << start_direction << '\n';
-        }
-        return nullptr;
+    return make_curve<Helix>(center, radius, step, normalized_axis, normalized_start_direction);
+}
+
+CreationResult<std::shared_ptr<Curve>> CurveFactory::try_create_random_curve_by_type(Curve_type curve_type) {
+    switch (curve_type) {
+    case Curve_type::circle: {
+        return to_curve_result(try_create_random_circle());
+    }
+    case Curve_type::ellipse: {
+        return to_curve_result(try_create_random_ellipse());
     }
+    case Curve_type::helix: {
+        return to_curve_result(try_create_random_helix());
+    }
+    default: {
+        return make_failure(Creation_error::invalid_curve_type, static_cast<double>(curve_type));
+    }
+    }
+}
+
+CreationResult<std::shared_ptr<Circle>> CurveFactory::try_create_random_circle() {
+    constexpr auto min_radius{math::precision};
+    constexpr auto max_radius{999999.9};
 
-    return std::shared_ptr<Helix>{new Helix(center, radius, step, normalized_axis, normalized_start_direction)};
+    const auto center{random_point()};
+    const auto radius{random_double(min_radius, max_radius)};
+    const auto plane_normal{random_vector()};
+    return try_create_circle(center, radius, plane_normal);
 }
 
-std::shared_ptr<Helix> CurveFactory::create_random_helix(bool log_error) {
+CreationResult<std::shared_ptr<Ellipse>> CurveFactory::try_create_random_ellipse() {
+    constexpr auto min_radius{math::precision};
+    constexpr auto max_radius{999999.9};
+
+    const auto center{random_point()};
+    const auto radius_major{random_double(min_radius, max_radius)};
+    const auto radius_minor{random_double(min_radius, max_radius)};
+    const auto plane_normal{random_vector()};
+    return try_create_ellipse(center, radius_major, radius_minor, plane_normal);
+}
+
+CreationResult<std::shared_ptr<Helix>> CurveFactory::try_create_random_helix() {
     constexpr auto min_radius{math::precision};
     constexpr auto max_radius{999999.9};
     constexpr auto min_step{math::precision};
@@ -229,7 +364,128 @@ std::shared_ptr<Helix> CurveFactory::create_random_helix(bool log_error) {
     const auto step{random_double(min_step, max_step)};
     const auto axis{random_vector()};
 
-    return create_helix(center, radius, step, axis, log_error);
+    return try_create_helix(center, radius, step, axis);
+}
+
+void CurveFactory::create_circles(const CircleBatchInput& input, CurveBatch<Circle>& output) {
+    parallel::TraceSpan span{"CurveFactory::create_circles"};
+    if (reject_mismatched_sizes(input, output)) {
+        return;
+    }
+    const auto size{input.size()};
+    output.status.assign(size, Creation_error::none);
+    std::span<Creation_error> status{output.status};
+
+    // The checks are done in the same order as in try_create_circle, so the same error is reported
+    normalize_batch_normals(input.normals, status, batch_frames);
+    for (std::size_t i{}; i < size; ++i) {
+        const bool invalid{input.radii[i] <= math::precision};
+        status[i] = (status[i] == Creation_error::none && invalid) ? Creation_error::invalid_radius : status[i];
+    }
+    build_batch_directions(input.normals, status, batch_frames);
+
+    output.curves.clear();
+    output.curves.reserve(size);
+    output.stats = CreationStats{};
+    for (std::size_t i{}; i < size; ++i) {
+        output.stats.record(status[i]);
+        if (status[i] == Creation_error::none) {
+            output.curves.push_back(Circle{get_batch_point(input.centers, i), input.radii[i],
+                batch_frames.get_normal(i), batch_frames.get_direction(i)});
+        }
+    }
+}
+
+void CurveFactory::create_ellipses(const EllipseBatchInput& input, CurveBatch<Ellipse>& output) {
+    parallel::TraceSpan span{"CurveFactory::create_ellipses"};
+    if (reject_mismatched_sizes(input, output)) {
+        return;
+    }
+    const auto size{input.size()};
+    output.status.assign(size, Creation_error::none);
+    std::span<Creation_error> status{output.status};
+
+    // The checks are done in the same order as in try_create_ellipse, so the same error is reported
+    normalize_batch_normals(input.normals, status, batch_frames);
+    for (std::size_t i{}; i < size; ++i) {
+        const bool invalid{input.radii_major[i] <= math::precision || input.radii_minor[i] <= math::precision};
+        status[i] = (status[i] == Creation_error::none && invalid) ? Creation_error::invalid_semi_axes : status[i];
+    }
+    build_batch_directions(input.normals, status, batch_frames);
+
+    output.curves.clear();
+    output.curves.reserve(size);
+    output.stats = CreationStats{};
+    for (std::size_t i{}; i < size; ++i) {
+        output.stats.record(status[i]);
+        if (status[i] == Creation_error::none) {
+            output.curves.push_back(Ellipse{get_batch_point(input.centers, i), input.radii_major[i],
+                input.radii_minor[i], batch_frames.get_normal(i), batch_frames.get_direction(i)});
+        }
+    }
+}
+
+void CurveFactory::create_helices(const HelixBatchInput& input, CurveBatch<Helix>& output) {
+    parallel::TraceSpan span{"CurveFactory::create_helices"};
+    if (reject_mismatched_sizes(input, output)) {
+        return;
+    }
+    const auto size{input.size()};
+    output.status.assign(size, Creation_error::none);
+    std::span<Creation_error> status{output.status};
+
+    // The checks are done in the same order as in try_create_helix, so the same error is reported
+    normalize_batch_normals(input.axes, status, batch_frames);
+    for (std::size_t i{}; i < size; ++i) {
+        const bool invalid{input.radii[i] <= math::precision || input.steps[i] <= math::precision};
+        status[i] =
+            (status[i] == Creation_error::none && invalid) ? Creation_error::invalid_helix_parameters : status[i];
+    }
+    build_batch_directions(input.axes, status, batch_frames);
+
+    output.curves.clear();
+    output.curves.reserve(size);
+    output.stats = CreationStats{};
+    for (std::size_t i{}; i < size; ++i) {
+        output.stats.record(status[i]);
+        if (status[i] == Creation_error::none) {
+            output.curves.push_back(Helix{get_batch_point(input.centers, i), input.radii[i], input.steps[i],
+                batch_frames.get_normal(i), batch_frames.get_direction(i)});
+        }
+    }
+}
+
+void CurveFactory::set_allocation_tracker(AllocationTracker* tracker) {
+    allocation_tracker.store(tracker, std::memory_order_release);
+}
+
+template <typename T, typename... Args>
+std::shared_ptr<T> CurveFactory::make_curve(Args&&... args) {
+    auto* const tracker{allocation_tracker.load(std::memory_order_acquire)};
+    if (!tracker) {
+        return std::shared_ptr<T>{new T(std::forward<Args>(args)...)};
+    }
+
+    // Counted only once the object exists; if the control block cannot be allocated, the deleter runs and
+    // balances the count
+    const std::size_t bytes{get_shared_object_usage(sizeof(T)).get_total()};
+    auto* const curve{new T(std::forward<Args>(args)...)};
+    tracker->on_allocate(bytes);
+    return std::shared_ptr<T>{curve, [tracker, bytes](T* object) {
+                                  delete object;
+                                  tracker->on_release(bytes);
+                              }};
+}
+
+template <typename T>
+std::shared_ptr<T> CurveFactory::unwrap(CreationResult<std::shared_ptr<T>>&& result, bool log_error) {
+    if (!result.has_value()) {
+        if (log_error) {
+            std::cout << "Error: " << result.failure() << '\n';
+        }
+        return nullptr;
+    }
+    return std::move(result).value();
 }
 
 double CurveFactory::random_double(double min, double max) {
@@ -0,0 +1,193 @@
+#include "curves/model3d/CurveProxy.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveEvaluation.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+constexpr std::size_t coefficient_count{CurveProxy::degree + 1};
+constexpr std::size_t interval_stride{3 * coefficient_count};
+constexpr std::size_t check_samples_per_interval{3 * coefficient_count};
+
+constexpr std::array<double, static_cast<std::size_t>(Approximation_tier::size)> relative_tolerances{
+    1e-3, // preview
+    1e-6, // standard
+    1e-10 // precise
+};
+
+// Center, size of the periodic part and the axial offset per radian
+struct CurveShape {
+    Point3d center;
+    double size;
+    Vector3d axis_shift;
+};
+
+std::optional<CurveShape> get_shape(const Curve& curve) {
+    if (const auto* circle{dynamic_cast<const Circle*>(&curve)}) {
+        return CurveShape{circle->get_center(), circle->get_radius(), Vector3d{0.0, 0.0, 0.0}};
+    }
+    if (const auto* ellipse{dynamic_cast<const Ellipse*>(&curve)}) {
+        return CurveShape{ellipse->get_center(), ellipse->get_radius_major(), Vector3d{0.0, 0.0, 0.0}};
+    }
+    if (const auto* helix{dynamic_cast<const Helix*>(&curve)}) {
+        const auto axis_shift{helix->get_axis() * (helix->get_step() / math::two_pi)};
+        return CurveShape{helix->get_center(), helix->get_radius(), axis_shift};
+    }
+    return std::nullopt;
+}
+
+// Chebyshev interpolation of one coordinate at the nodes x_k = cos(pi * (k + 1/2) / N):
+// c_j = 2 / N * sum_k f(x_k) * cos(pi * j * (k + 1/2) / N), c_0 halved so that f(x) = sum_j c_j * T_j(x)
+void fit_interval(std::span<const std::array<double, 3>> values, std::span<double> coefficients) {
+    const auto node_count{static_cast<double>(coefficient_count)};
+    for (std::size_t coordinate{}; coordinate < 3; ++coordinate) {
+        for (std::size_t j{}; j < coefficient_count; ++j) {
+            double sum{};
+            for (std::size_t k{}; k < coefficient_count; ++k) {
+                sum += values[k][coordinate]
+                    * std::cos(math::pi * static_cast<double>(j) * (static_cast<double>(k) + 0.5) / node_count);
+            }
+            coefficients[coordinate * coefficient_count + j] = (j == 0 ? 1.0 : 2.0) * sum / node_count;
+        }
+    }
+}
+
+} // namespace
+
+double get_relative_tolerance(Approximation_tier tier) {
+    return relative_tolerances[static_cast<std::size_t>(tier)];
+}
+
+std::optional<CurveProxy> CurveProxy::build(const Curve& curve, Approximation_tier tier) {
+    const auto shape{get_shape(curve)};
+    if (!shape) {
+        return std::nullopt;
+    }
+    return build(curve, shape->size * get_relative_tolerance(tier));
+}
+
+std::optional<CurveProxy> CurveProxy::build(const Curve& curve, double tolerance) {
+    const auto shape{get_shape(curve)};
+    if (!shape) {
+        return std::nullopt;
+    }
+
+    std::array<double, coefficient_count> nodes{};
+    for (std::size_t k{}; k < coefficient_count; ++k) {
+        nodes[k] = std::cos(math::pi * (static_cast<double>(k) + 0.5) / static_cast<double>(coefficient_count));
+    }
+
+    CurveProxy proxy{};
+    proxy._center = shape->center;
+    proxy._axis_shift = shape->axis_shift;
+
+    std::array<std::array<double, 3>, coefficient_count> point_values{};
+    std::array<std::array<double, 3>, coefficient_count> derivative_values{};
+    for (std::size_t interval_count{1}; interval_count <= max_interval_count; interval_count *= 2) {
+        proxy._interval_count = interval_count;
+        proxy._interval_scale = static_cast<double>(interval_count) / math::two_pi;
+        proxy._point_coefficients.assign(interval_count * interval_stride, 0.0);
+        proxy._derivative_coefficients.assign(interval_count * interval_stride, 0.0);
+
+        const double half_width{math::pi / static_cast<double>(interval_count)};
+        for (std::size_t interval{}; interval < interval_count; ++interval) {
+            const double mid{(2.0 * static_cast<double>(interval) + 1.0) * half_width};
+            for (std::size_t k{}; k < coefficient_count; ++k) {
+                // The center and the axial term are removed, so the fitted part is periodic and of the size of
+                // the curve; far from the origin the coordinates would otherwise swamp the tolerance
+                const double angle{mid + half_width * nodes[k]};
+                const auto evaluation{curve.evaluate(angle, 1)};
+                const auto offset{evaluation.point - shape->center};
+                for (std::size_t coordinate{}; coordinate < 3; ++coordinate) {
+                    const double shift{shape->axis_shift.data()[coordinate]};
+                    point_values[k][coordinate] = offset.data()[coordinate] - shift * angle;
+                    derivative_values[k][coordinate] = evaluation.first_derivative.data()[coordinate] - shift;
+                }
+            }
+            fit_interval(point_values,
+                std::span<double>{proxy._point_coefficients}.subspan(interval * interval_stride, interval_stride));
+            fit_interval(derivative_values,
+                std::span<double>{proxy._derivative_coefficients}.subspan(interval * interval_stride, interval_stride));
+        }
+
+        proxy._point_error = 0.0;
+        proxy._derivative_error = 0.0;
+        const std::size_t check_count{interval_count * check_samples_per_interval};
+        for (std::size_t i{}; i < check_count; ++i) {
+            const double angle{math::two_pi * (static_cast<double>(i) + 0.5) / static_cast<double>(check_count)};
+            const auto evaluation{curve.evaluate(angle, 1)};
+            double x{};
+            const auto interval{proxy.get_interval(angle, x)};
+            const auto series{proxy.evaluate_series(proxy._point_coefficients, interval, x)};
+            const auto offset{series + proxy._axis_shift * angle};
+            proxy._point_error =
+                std::max(proxy._point_error, (offset - (evaluation.point - shape->center)).get_magnitude());
+            proxy._derivative_error = std::max(proxy._derivative_error,
+                (proxy.get_first_derivative(angle) - evaluation.first_derivative).get_magnitude());
+        }
+
+        if (proxy._point_error <= tolerance && proxy._derivative_error <= tolerance) {
+            return proxy;
+        }
+    }
+
+    return std::nullopt;
+}
+
+double CurveProxy::get_angle(double t) const {
+    return t - math::two_pi * std::floor(t / math::two_pi);
+}
+
+std::size_t CurveProxy::get_interval(double angle, double& x) const {
+    const double position{angle * _interval_scale};
+    // min instead of a branch: rounding can put the angle at 2pi
+    const auto interval{std::min(static_cast<std::size_t>(position), _interval_count - 1)};
+    x = 2.0 * (position - static_cast<double>(interval)) - 1.0;
+    return interval;
+}
+
+Vector3d CurveProxy::evaluate_series(const std::vector<double>& coefficients, std::size_t interval, double x) const {
+    // Clenshaw: b_j = c_j + 2x * b_(j+1) - b_(j+2), f(x) = c_0 + x * b_1 - b_2
+    Vector3d result{};
+    const double* interval_coefficients{coefficients.data() + interval * interval_stride};
+    for (std::size_t coordinate{}; coordinate < 3; ++coordinate) {
+        const double* c{interval_coefficients + coordinate * coefficient_count};
+        double b1{};
+        double b2{};
+        for (std::size_t j{degree}; j > 0; --j) {
+            const double b0{c[j] + 2.0 * x * b1 - b2};
+            b2 = b1;
+            b1 = b0;
+        }
+        result.data()[coordinate] = c[0] + x * b1 - b2;
+    }
+    return result;
+}
+
+Point3d CurveProxy::get_point(double t) const {
+    double x{};
+    const auto interval{get_interval(get_angle(t), x)};
+    return math::translate(_center, evaluate_series(_point_coefficients, interval, x) + _axis_shift * t);
+}
+
+Vector3d CurveProxy::get_first_derivative(double t) const {
+    double x{};
+    const auto interval{get_interval(get_angle(t), x)};
+    return evaluate_series(_derivative_coefficients, interval, x) + _axis_shift;
+}
+
+void CurveProxy::sample_uniform(double t0, double dt, std::span<Point3d> out) const {
+    for (std::size_t i{}; i < out.size(); ++i) {
+        out[i] = get_point(t0 + static_cast<double>(i) * dt);
+    }
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,92 @@
+#include "curves/model3d/CurveStore.h"
+
+namespace curves {
+namespace model3d {
+
+std::optional<CurveStore> CurveStore::compact(std::span<const std::shared_ptr<Curve>> curves) {
+    std::array<std::size_t, static_cast<std::size_t>(CurveFactory::Curve_type::size)> counts{};
+    for (const auto& curve : curves) {
+        if (dynamic_cast<const Circle*>(curve.get())) {
+            ++counts[static_cast<std::size_t>(CurveFactory::Curve_type::circle)];
+        } else if (dynamic_cast<const Ellipse*>(curve.get())) {
+            ++counts[static_cast<std::size_t>(CurveFactory::Curve_type::ellipse)];
+        } else if (dynamic_cast<const Helix*>(curve.get())) {
+            ++counts[static_cast<std::size_t>(CurveFactory::Curve_type::helix)];
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    // Exact sizes: no reallocation while filling, no unused capacity afterwards
+    CurveStore store;
+    store._circles.reserve(counts[static_cast<std::size_t>(CurveFactory::Curve_type::circle)]);
+    store._ellipses.reserve(counts[static_cast<std::size_t>(CurveFactory::Curve_type::ellipse)]);
+    store._helices.reserve(counts[static_cast<std::size_t>(CurveFactory::Curve_type::helix)]);
+    store._entries.reserve(curves.size());
+
+    for (const auto& curve : curves) {
+        if (const auto circle{dynamic_cast<const Circle*>(curve.get())}) {
+            store._entries.push_back(
+                {CurveFactory::Curve_type::circle, static_cast<std::uint32_t>(store._circles.size())});
+            store._circles.push_back(*circle);
+        } else if (const auto ellipse{dynamic_cast<const Ellipse*>(curve.get())}) {
+            store._entries.push_back(
+                {CurveFactory::Curve_type::ellipse, static_cast<std::uint32_t>(store._ellipses.size())});
+            store._ellipses.push_back(*ellipse);
+        } else if (const auto helix{dynamic_cast<const Helix*>(curve.get())}) {
+            store._entries.push_back(
+                {CurveFactory::Curve_type::helix, static_cast<std::uint32_t>(store._helices.size())});
+            store._helices.push_back(*helix);
+        }
+    }
+    return store;
+}
+
+CurveStore CurveStore::reordered(std::span<const std::uint32_t> order) const {
+    CurveStore store;
+    store._circles.reserve(_circles.size());
+    store._ellipses.reserve(_ellipses.size());
+    store._helices.reserve(_helices.size());
+    store._entries.reserve(order.size());
+
+    // The arrays of every type follow the new order as well
+    for (const auto index : order) {
+        const auto& entry{_entries[index]};
+        switch (entry.type) {
+        case CurveFactory::Curve_type::circle: {
+            store._entries.push_back({entry.type, static_cast<std::uint32_t>(store._circles.size())});
+            store._circles.push_back(_circles[entry.index]);
+            break;
+        }
+        case CurveFactory::Curve_type::ellipse: {
+            store._entries.push_back({entry.type, static_cast<std::uint32_t>(store._ellipses.size())});
+            store._ellipses.push_back(_ellipses[entry.index]);
+            break;
+        }
+        default: {
+            store._entries.push_back({entry.type, static_cast<std::uint32_t>(store._helices.size())});
+            store._helices.push_back(_helices[entry.index]);
+            break;
+        }
+        }
+    }
+    return store;
+}
+
+const Curve& CurveStore::operator[](std::size_t index) const {
+    const auto& entry{_entries[index]};
+    switch (entry.type) {
+    case CurveFactory::Curve_type::circle: {
+        return _circles[entry.index];
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        return _ellipses[entry.index];
+    }
+    default: {
+        return _helices[entry.index];
+    }
+    }
+}
+
+} // namespace model3d
+} // namespace curves
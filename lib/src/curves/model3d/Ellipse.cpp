@@ -1,6 +1,8 @@
 #include "curves/model3d/Ellipse.h"
 
 #include "curves/math/LinearAlgebra.h"
+#include "curves/math/SinCosSequence.h"
+#include "curves/math/VectorExpression.h"
 #include "curves/model3d/Curve.h"
 
 namespace curves {
@@ -25,12 +27,8 @@ Point3d Ellipse::get_point(double t) const {
     const auto cos{std::cos(t)};
     const auto sin{std::sin(t)};
 
-    const auto offset_u{_axis_x * (cos * _radius_major)}; // a * cos(t) * U
-    const auto offset_v{_axis_y * (sin * _radius_minor)}; // b * sin(t) * V
-
-    const auto offset{offset_u + offset_v};
-
-    return math::translate(_center, offset);
+    using math::lazy;
+    return lazy(_center) + (lazy(_axis_x) * (cos * _radius_major) + lazy(_axis_y) * (sin * _radius_minor));
 }
 
 Vector3d Ellipse::get_first_derivative(double t) const {
@@ -41,10 +39,60 @@ Vector3d Ellipse::get_first_derivative(double t) const {
     const auto cos{std::cos(t)};
     const auto sin{std::sin(t)};
 
-    const auto offset_v{_axis_y * (cos * _radius_minor)}; // b * cos(t) * V
-    const auto offset_u{_axis_x * (sin * _radius_major)}; // a * sin(x) * U
+    using math::lazy;
+    return lazy(_axis_y) * (cos * _radius_minor) - lazy(_axis_x) * (sin * _radius_major);
+}
+
+CurveEvaluation Ellipse::evaluate(double t, std::size_t order) const {
+    // Formula: P(t) = C + a * cos(t) * U + b * sin(t) * V
+    //          P'(t) = b * cos(t) * V - a * sin(t) * U
+    //          P''(t) = -( a * cos(t) * U + b * sin(t) * V )
+    // Where U is _axis_x and V is _axis_y
+    // Where a is _radius_major and b is _radius_minor
+    // One sin/cos pair for all orders, computed per coordinate without vector temporaries
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    CurveEvaluation result;
+    for (std::size_t i{}; i < 3; ++i) {
+        const double offset{_axis_x.data()[i] * (cos * _radius_major) + _axis_y.data()[i] * (sin * _radius_minor)};
+        result.point.data()[i] = _center.data()[i] + offset;
+        if (order >= 1) {
+            result.first_derivative.data()[i] =
+                _axis_y.data()[i] * (cos * _radius_minor) - _axis_x.data()[i] * (sin * _radius_major);
+        }
+        if (order >= 2) {
+            result.second_derivative.data()[i] = -offset;
+        }
+    }
+    return result;
+}
+
+void Ellipse::evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const {
+    for (std::size_t i{}; i < t.size(); ++i) {
+        out[i] = Ellipse::evaluate(t[i], order);
+    }
+}
+
+double Ellipse::get_max_acceleration() const {
+    // |P''(t)| = |a * cos(t) * U + b * sin(t) * V| <= max(a, b)
+    return std::max(_radius_major, _radius_minor);
+}
+
+void Ellipse::sample_uniform(double t0, double dt, std::span<Point3d> out) const {
+    // Formula: P(t) = C + (a * U) * cos(t) + (b * V) * sin(t)
+
+    const auto radius_u{_axis_x * _radius_major};
+    const auto radius_v{_axis_y * _radius_minor};
 
-    return offset_v - offset_u;
+    math::SinCosSequence sincos{t0, dt};
+    for (auto& point : out) {
+        for (std::size_t i{}; i < 3; ++i) {
+            point.data()[i] = _center.data()[i] + radius_u.data()[i] * sincos.cos() + radius_v.data()[i] * sincos.sin();
+        }
+        sincos.next();
+    }
 }
 
 } // namespace model3d
@@ -2,6 +2,8 @@
 
 #include "curves/math/Constants.h"
 #include "curves/math/LinearAlgebra.h"
+#include "curves/math/SinCosSequence.h"
+#include "curves/math/VectorExpression.h"
 #include "curves/model3d/Curve.h"
 
 namespace curves {
@@ -14,36 +16,128 @@ Helix::Helix(const Point3d& center, double radius, double step, const Vector3d&
 Helix::~Helix() = default;
 
 Point3d Helix::get_point(double t) const {
+    return get_point(split_parameter(t));
+}
+
+Vector3d Helix::get_first_derivative(double t) const {
+    return get_first_derivative(split_parameter(t));
+}
+
+Point3d Helix::get_point(const HelixParameter& parameter) const {
     // Formula: P(t) = C + R * ( cos(t) * U + sin(t) * V ) + (h * t / 2pi) * N
     // Where U is _axis_x , V is _axis_y and N is _axis
     // Counterclockwise rotation
+    // With t = 2pi * turn + angle: cos(t) = cos(angle), sin(t) = sin(angle), h * t / 2pi = h * (turn + angle / 2pi)
+
+    const auto cos{std::cos(parameter.angle)};
+    const auto sin{std::sin(parameter.angle)};
+    const double height{_step * (static_cast<double>(parameter.turn) + parameter.angle / math::two_pi)};
+
+    using math::lazy;
+    return lazy(_center) + ((lazy(_axis_x) * cos + lazy(_axis_y) * sin) * _radius + lazy(_axis) * height);
+}
 
-    const auto cos{std::cos(t)};
-    const auto sin{std::sin(t)};
+Vector3d Helix::get_first_derivative(const HelixParameter& parameter) const {
+    // Formula: P'(t) = R * (cos(t) * V - sin(t) * U) + ( h / 2pi) * N
+    // Where U is _axis_x , V is _axis_y and N is _axis
 
-    const auto offset_u_without_radius{_axis_x * cos}; // cos(t) * U
-    const auto offset_v_without_radius{_axis_y * sin}; // sin(t) * V
-    const auto offset_n{_axis * (_step * t / math::two_pi)}; // (h * t / 2pi) * N
+    const auto cos{std::cos(parameter.angle)};
+    const auto sin{std::sin(parameter.angle)};
 
-    const auto offset_uv_without_radius{offset_u_without_radius + offset_v_without_radius};
-    const auto offset{offset_uv_without_radius * _radius + offset_n};
+    using math::lazy;
+    return (lazy(_axis_y) * cos - lazy(_axis_x) * sin) * _radius + lazy(_axis) * (_step / math::two_pi);
+}
 
-    return math::translate(_center, offset);
+CurveEvaluation Helix::evaluate(double t, std::size_t order) const {
+    return evaluate(split_parameter(t), order);
 }
 
-Vector3d Helix::get_first_derivative(double t) const {
-    // Formula: P'(t) = R * (cos(t) * V - sin(t) * U) + ( h / 2pi) * N
+void Helix::evaluate(std::span<const double> t, std::size_t order, std::span<CurveEvaluation> out) const {
+    for (std::size_t i{}; i < t.size(); ++i) {
+        out[i] = evaluate(split_parameter(t[i]), order);
+    }
+}
+
+CurveEvaluation Helix::evaluate(const HelixParameter& parameter, std::size_t order) const {
+    // Formula: P(t) = C + R * ( cos(t) * U + sin(t) * V ) + (h * t / 2pi) * N
+    //          P'(t) = R * (cos(t) * V - sin(t) * U) + ( h / 2pi) * N
+    //          P''(t) = -R * ( cos(t) * U + sin(t) * V )
     // Where U is _axis_x , V is _axis_y and N is _axis
+    // One sin/cos pair for all orders, computed per coordinate without vector temporaries
+
+    const auto cos{std::cos(parameter.angle)};
+    const auto sin{std::sin(parameter.angle)};
+    const double height{_step * (static_cast<double>(parameter.turn) + parameter.angle / math::two_pi)};
+    const double rise{_step / math::two_pi};
+
+    CurveEvaluation result;
+    for (std::size_t i{}; i < 3; ++i) {
+        const double offset_uv{(_axis_x.data()[i] * cos + _axis_y.data()[i] * sin) * _radius};
+        result.point.data()[i] = _center.data()[i] + (offset_uv + _axis.data()[i] * height);
+        if (order >= 1) {
+            result.first_derivative.data()[i] =
+                (_axis_y.data()[i] * cos - _axis_x.data()[i] * sin) * _radius + _axis.data()[i] * rise;
+        }
+        if (order >= 2) {
+            result.second_derivative.data()[i] = -offset_uv;
+        }
+    }
+    return result;
+}
+
+HelixParameter Helix::split_parameter(double t) {
+    // Cody-Waite reduction: 2pi = two_pi_high + two_pi_low, turn * two_pi_high is subtracted exactly by fma
+    constexpr double two_pi_high{6.283185307179586};
+    constexpr double two_pi_low{2.4492935982947064e-16};
+
+    double turn{std::floor(t / math::two_pi)};
+    double angle{std::fma(-turn, two_pi_high, t) - turn * two_pi_low};
+
+    // The quotient may be rounded to the neighbouring turn
+    if (angle < 0.0) {
+        angle += math::two_pi;
+        turn -= 1.0;
+    } else if (angle >= math::two_pi) {
+        angle -= math::two_pi;
+        turn += 1.0;
+    }
+    if (angle >= math::two_pi) {
+        angle = 0.0;
+        turn += 1.0;
+    }
+
+    // Not finite or beyond the turn counter: the cast would be undefined, and from |t| = 2^55 on the ulp of t exceeds
+    // 2pi, so there is no angle to keep
+    constexpr double turn_limit{static_cast<double>(std::numeric_limits<std::int64_t>::max())}; // 2^63 after rounding
+    if (!(turn >= -turn_limit && turn < turn_limit)) {
+        return HelixParameter{0, std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    return HelixParameter{static_cast<std::int64_t>(turn), angle};
+}
+
+double Helix::get_max_acceleration() const {
+    // |P''(t)| = R, the axial term is linear
+    return _radius;
+}
 
-    const auto cos{std::cos(t)};
-    const auto sin{std::sin(t)};
+void Helix::sample_uniform(double t0, double dt, std::span<Point3d> out) const {
+    // Formula: P(t) = C + (R * U) * cos(t) + (R * V) * sin(t) + (h * t / 2pi) * N
+    // The axial term is linear in t and is evaluated directly, so it does not accumulate errors
 
-    const auto offset_v_without_radius{_axis_y * cos}; // cos(t) * V
-    const auto offset_u_without_radius{_axis_x * sin}; // sin(t) * U
-    const auto offset_uv_without_radius{offset_v_without_radius - offset_u_without_radius};
-    const auto offset_n{_axis * (_step / math::two_pi)}; // ( h / 2pi) * N
+    const auto radius_u{_axis_x * _radius};
+    const auto radius_v{_axis_y * _radius};
+    const double rise{_step / math::two_pi};
 
-    return offset_uv_without_radius * _radius + offset_n;
+    math::SinCosSequence sincos{t0, dt};
+    for (auto& point : out) {
+        const double height{rise * sincos.t()};
+        for (std::size_t i{}; i < 3; ++i) {
+            point.data()[i] = _center.data()[i] + radius_u.data()[i] * sincos.cos() +
+                radius_v.data()[i] * sincos.sin() + _axis.data()[i] * height;
+        }
+        sincos.next();
+    }
 }
 
 } // namespace model3d
@@ -0,0 +1,254 @@
+#include "curves/model3d/MemoryUsage.h"
+
+#include "curves/index/RadiusIndex.h"
+#include "curves/intersection3d/CircleAxisIndex.h"
+#include "curves/math/Point.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CompactCurveBlock.h"
+#include "curves/model3d/CurveProxy.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/model3d/TessellationCache.h"
+#include "curves/parallel/CurveRegistry.h"
+#include "curves/parallel/PartitionedCurveStore.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+// glibc malloc: 8 byte chunk header, 16 byte alignment, 32 byte minimum chunk
+constexpr std::size_t chunk_header{8};
+constexpr std::size_t chunk_alignment{16};
+constexpr std::size_t min_chunk{32};
+
+// libstdc++ control block of shared_ptr{new T}: vtable pointer, use and weak counters, owned pointer
+constexpr std::size_t shared_control_block_size{24};
+// libstdc++ control block of make_shared without the object: vtable pointer, use and weak counters
+constexpr std::size_t inplace_control_block_size{16};
+
+// libstdc++ node bookkeeping: std::list node links, unordered_map node next pointer and cached hash
+constexpr std::size_t list_node_links{2 * sizeof(void*)};
+constexpr std::size_t hash_node_links{sizeof(void*) + sizeof(std::size_t)};
+
+std::size_t get_object_size(const Curve& curve) {
+    if (dynamic_cast<const Circle*>(&curve)) {
+        return sizeof(Circle);
+    }
+    if (dynamic_cast<const Ellipse*>(&curve)) {
+        return sizeof(Ellipse);
+    }
+    if (dynamic_cast<const Helix*>(&curve)) {
+        return sizeof(Helix);
+    }
+    return sizeof(Curve);
+}
+
+// Node of a node based container: the value is counted by the caller, the links as index
+MemoryUsage get_node_usage(std::size_t value_size, std::size_t links) {
+    MemoryUsage usage;
+    usage.index = links;
+    usage.allocator_overhead = get_allocation_overhead(value_size + links);
+    return usage;
+}
+
+// Object allocated on its own with new, counted as index
+MemoryUsage get_index_object_usage(std::size_t object_size) {
+    MemoryUsage usage;
+    usage.index = object_size;
+    usage.allocator_overhead = get_allocation_overhead(object_size);
+    return usage;
+}
+
+// Every distinct curve with its control block
+MemoryUsage get_shared_curves_usage(std::vector<const Curve*>& objects) {
+    std::sort(objects.begin(), objects.end());
+    objects.erase(std::unique(objects.begin(), objects.end()), objects.end());
+
+    MemoryUsage usage;
+    for (const auto object : objects) {
+        usage += get_shared_object_usage(get_object_size(*object));
+    }
+    return usage;
+}
+
+} // namespace
+
+MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& other) {
+    payload += other.payload;
+    allocator_overhead += other.allocator_overhead;
+    index += other.index;
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage) {
+    return os << "payload: " << usage.payload << " B, allocator overhead: " << usage.allocator_overhead
+              << " B, index: " << usage.index << " B, total: " << usage.get_total() << " B";
+}
+
+std::size_t get_allocation_overhead(std::size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    const std::size_t chunk{(size + chunk_header + chunk_alignment - 1) / chunk_alignment * chunk_alignment};
+    return std::max(chunk, min_chunk) - size;
+}
+
+MemoryUsage get_shared_object_usage(std::size_t object_size) {
+    MemoryUsage usage;
+    usage.payload = object_size;
+    usage.allocator_overhead = get_allocation_overhead(object_size) + shared_control_block_size +
+                               get_allocation_overhead(shared_control_block_size);
+    return usage;
+}
+
+MemoryUsage memory_usage(const Curve& curve) {
+    MemoryUsage usage;
+    usage.payload = get_object_size(curve);
+    return usage;
+}
+
+MemoryUsage memory_usage(const std::vector<std::shared_ptr<Curve>>& curves) {
+    MemoryUsage usage{get_buffer_usage(curves, false)};
+
+    std::vector<const Curve*> objects;
+    objects.reserve(curves.size());
+    for (const auto& curve : curves) {
+        if (curve) {
+            objects.push_back(curve.get());
+        }
+    }
+    usage += get_shared_curves_usage(objects);
+    return usage;
+}
+
+MemoryUsage memory_usage(const CompactCurveBlock& block) {
+    MemoryUsage usage{get_buffer_usage(block.get_curves(), true)};
+    usage.index += sizeof(CompactCurveBlock) - sizeof(std::vector<CompactCurve>); // Block origin and steps
+    return usage;
+}
+
+MemoryUsage memory_usage(const CurveStore& store) {
+    MemoryUsage usage{get_buffer_usage(store._circles, true)};
+    usage += get_buffer_usage(store._ellipses, true);
+    usage += get_buffer_usage(store._helices, true);
+    usage += get_buffer_usage(store._entries, false);
+    return usage;
+}
+
+MemoryUsage memory_usage(const TessellationCache& cache) {
+    std::lock_guard lock{cache._mutex};
+
+    MemoryUsage usage;
+    for (const auto& entry : cache._lru) {
+        // Points are shared with the callers, counted once per entry: make_shared vector plus its buffer
+        usage += get_buffer_usage(*entry.points, true);
+        usage.allocator_overhead += inplace_control_block_size + sizeof(std::vector<Point3d>) +
+                                    get_allocation_overhead(inplace_control_block_size + sizeof(std::vector<Point3d>));
+
+        usage.index += sizeof(TessellationCache::Entry);
+        usage += get_node_usage(sizeof(TessellationCache::Entry), list_node_links);
+
+        using Map_value = decltype(cache._entries)::value_type;
+        usage.index += sizeof(Map_value);
+        usage += get_node_usage(sizeof(Map_value), hash_node_links);
+    }
+
+    const std::size_t buckets{cache._entries.bucket_count() * sizeof(void*)};
+    usage.index += buckets;
+    usage.allocator_overhead += get_allocation_overhead(buckets);
+    return usage;
+}
+
+MemoryUsage memory_usage(const CurveProxy& proxy) {
+    MemoryUsage usage{get_buffer_usage(proxy._point_coefficients, true)};
+    usage += get_buffer_usage(proxy._derivative_coefficients, true);
+    return usage;
+}
+
+MemoryUsage memory_usage(const parallel::PartitionedCurveStore& store) {
+    MemoryUsage usage{get_buffer_usage(store._stores, false)};
+    for (const auto& partition : store._stores) {
+        usage += memory_usage(partition);
+    }
+    usage += get_buffer_usage(store._offsets, false);
+    usage += get_buffer_usage(store._partitions, false);
+    return usage;
+}
+
+MemoryUsage memory_usage(const index::RadiusIndex& index) {
+    MemoryUsage usage{get_buffer_usage(index._items, false)};
+    usage += get_buffer_usage(index._eytzinger, false);
+    usage += get_buffer_usage(index._eytzinger_rank, false);
+    return usage;
+}
+
+MemoryUsage memory_usage(const intersection3d::CircleAxisIndex& index) {
+    MemoryUsage usage{get_buffer_usage(index._circles, false)};
+    for (const auto& [key, cell] : index._cells) {
+        using Map_value = decltype(index._cells)::value_type;
+        usage.index += sizeof(Map_value);
+        usage += get_node_usage(sizeof(Map_value), hash_node_links);
+        usage += get_buffer_usage(cell, false);
+    }
+
+    const std::size_t buckets{index._cells.bucket_count() * sizeof(void*)};
+    usage.index += buckets;
+    usage.allocator_overhead += get_allocation_overhead(buckets);
+    return usage;
+}
+
+MemoryUsage memory_usage(const parallel::CurveRegistry& registry) {
+    using Registry = parallel::CurveRegistry;
+
+    MemoryUsage usage;
+    std::vector<const Curve*> objects;
+    const auto add_node = [&](const Registry::Node& node) {
+        usage += get_index_object_usage(sizeof(Registry::Node));
+        objects.push_back(node.curve.get());
+    };
+
+    for (const auto& segment : registry._segments) {
+        if (const auto slots{segment.load(std::memory_order_acquire)}) {
+            usage += get_index_object_usage(Registry::segment_size * sizeof(Registry::Slot));
+            for (std::uint32_t i{}; i < Registry::segment_size; ++i) {
+                if (const auto node{slots[i].node.load(std::memory_order_acquire)}) {
+                    add_node(*node);
+                }
+            }
+        }
+    }
+    for (auto node{registry._retired.load(std::memory_order_acquire)}; node; node = node->next_retired) {
+        add_node(*node);
+    }
+    for (auto participant{registry._participants.load(std::memory_order_acquire)}; participant;
+         participant = participant->next) {
+        usage += get_index_object_usage(sizeof(Registry::Participant));
+    }
+
+    usage += get_shared_curves_usage(objects);
+    return usage;
+}
+
+void AllocationTracker::on_allocate(std::size_t bytes) {
+    const std::size_t current{_current_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes};
+    _live_count.fetch_add(1, std::memory_order_relaxed);
+    _allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t peak{_peak_bytes.load(std::memory_order_relaxed)};
+    while (current > peak && !_peak_bytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+void AllocationTracker::on_release(std::size_t bytes) {
+    _current_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    _live_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void AllocationTracker::reset_peak() {
+    _peak_bytes.store(_current_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+} // namespace model3d
+} // namespace curves
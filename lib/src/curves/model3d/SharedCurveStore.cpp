@@ -0,0 +1,356 @@
+#include "curves/model3d/SharedCurveStore.h"
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/model3d/MemoryUsage.h"
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+constexpr std::uint32_t segment_magic{0x43435353}; // "SSCC"
+constexpr std::uint32_t segment_layout{1};
+constexpr std::size_t slot_count{2};
+constexpr std::size_t snapshot_attempts{64};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "the counters are shared between processes");
+
+std::size_t align_up(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::optional<SharedCurveRecord> make_record(const Curve& curve) {
+    if (const auto* circle{dynamic_cast<const Circle*>(&curve)}) {
+        return SharedCurveRecord{circle->get_center().data(), circle->get_radius(), 0.0,
+            circle->get_axis_x().data(), circle->get_axis_y().data(), circle->get_axis().data(),
+            static_cast<std::uint64_t>(CurveFactory::Curve_type::circle)};
+    }
+    if (const auto* ellipse{dynamic_cast<const Ellipse*>(&curve)}) {
+        return SharedCurveRecord{ellipse->get_center().data(), ellipse->get_radius_major(),
+            ellipse->get_radius_minor(), ellipse->get_axis_x().data(), ellipse->get_axis_y().data(),
+            ellipse->get_axis().data(), static_cast<std::uint64_t>(CurveFactory::Curve_type::ellipse)};
+    }
+    if (const auto* helix{dynamic_cast<const Helix*>(&curve)}) {
+        return SharedCurveRecord{helix->get_center().data(), helix->get_radius(), helix->get_step(),
+            helix->get_axis_x().data(), helix->get_axis_y().data(), helix->get_axis().data(),
+            static_cast<std::uint64_t>(CurveFactory::Curve_type::helix)};
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+// Offsets are counted from the start of the segment
+struct SharedCurveStore::SegmentHeader {
+    std::uint32_t magic;
+    std::uint32_t layout;
+    std::uint64_t capacity; // Curves per slot
+    std::array<std::uint64_t, slot_count> slot_offsets;
+    std::atomic<std::uint64_t> version; // Latest published, held by slot version % 2
+};
+
+struct SharedCurveStore::SlotHeader {
+    std::atomic<std::uint64_t> sequence; // Odd while the writer fills the slot
+    std::uint64_t version;
+    std::uint64_t count;
+    std::uint64_t records_offset; // From the slot header
+};
+
+SharedCurveView::SharedCurveView(const std::atomic<std::uint64_t>* sequence,
+    std::uint64_t expected_sequence,
+    std::uint64_t version,
+    std::span<const SharedCurveRecord> records)
+    : _sequence{sequence}, _expected_sequence{expected_sequence}, _version{version}, _records{records} {
+}
+
+Point3d SharedCurveView::get_point(std::size_t index, double t) const {
+    // Formula: P(t) = C + a * cos(t) * U + b * sin(t) * V (+ (h * t / 2pi) * N for a helix)
+    // Where a = b = R for a circle and a helix
+    const auto& record{_records[index]};
+    const Point3d center{record.center};
+    const Vector3d axis_x{record.axis_x};
+    const Vector3d axis_y{record.axis_y};
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        return math::translate(center, (axis_x * cos + axis_y * sin) * record.size_a);
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        return math::translate(center, axis_x * (record.size_a * cos) + axis_y * (record.size_b * sin));
+    }
+    case CurveFactory::Curve_type::helix: {
+        const auto offset_n{Vector3d{record.axis} * (record.size_b * t / math::two_pi)};
+        return math::translate(center, (axis_x * cos + axis_y * sin) * record.size_a + offset_n);
+    }
+    default: {
+        return center;
+    }
+    }
+}
+
+Vector3d SharedCurveView::get_first_derivative(std::size_t index, double t) const {
+    // Formula: P'(t) = b * cos(t) * V - a * sin(t) * U (+ (h / 2pi) * N for a helix)
+    const auto& record{_records[index]};
+    const Vector3d axis_x{record.axis_x};
+    const Vector3d axis_y{record.axis_y};
+
+    const auto cos{std::cos(t)};
+    const auto sin{std::sin(t)};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        return (axis_y * cos - axis_x * sin) * record.size_a;
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        return axis_y * (record.size_b * cos) - axis_x * (record.size_a * sin);
+    }
+    case CurveFactory::Curve_type::helix: {
+        const auto offset_n{Vector3d{record.axis} * (record.size_b / math::two_pi)};
+        return (axis_y * cos - axis_x * sin) * record.size_a + offset_n;
+    }
+    default: {
+        return Vector3d{0.0, 0.0, 0.0};
+    }
+    }
+}
+
+std::shared_ptr<Curve> SharedCurveView::decode(std::size_t index) const {
+    const auto& record{_records[index]};
+    const Point3d center{record.center};
+    const Vector3d axis_x{record.axis_x};
+    const Vector3d axis{record.axis};
+
+    switch (get_type(index)) {
+    case CurveFactory::Curve_type::circle: {
+        auto result{CurveFactory::try_create_circle(center, record.size_a, axis, axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    case CurveFactory::Curve_type::ellipse: {
+        auto result{CurveFactory::try_create_ellipse(center, record.size_a, record.size_b, axis, axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    case CurveFactory::Curve_type::helix: {
+        auto result{CurveFactory::try_create_helix(center, record.size_a, record.size_b, axis, axis_x)};
+        return result ? std::shared_ptr<Curve>{*result} : nullptr;
+    }
+    default: {
+        return nullptr;
+    }
+    }
+}
+
+bool SharedCurveView::is_valid() const {
+    // Orders the reads of the records before the check, the seqlock read side
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return _sequence->load(std::memory_order_relaxed) == _expected_sequence;
+}
+
+std::optional<SharedCurveStore> SharedCurveStore::create(const std::string& name, std::size_t capacity) {
+#ifdef __unix__
+    const auto page{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+    const std::size_t slot_size{align_up(sizeof(SlotHeader) + capacity * sizeof(SharedCurveRecord), page)};
+    const std::size_t header_size{align_up(sizeof(SegmentHeader), page)};
+    const std::size_t size{header_size + slot_count * slot_size};
+
+    shm_unlink(name.c_str());
+    const int descriptor{shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644)};
+    if (descriptor < 0) {
+        return std::nullopt;
+    }
+    // The pages are zero until touched, an unused capacity costs address space only
+    const bool sized{ftruncate(descriptor, static_cast<off_t>(size)) == 0};
+    void* data{sized ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0) : MAP_FAILED};
+    close(descriptor);
+    if (data == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        return std::nullopt;
+    }
+
+    auto* header{new (data) SegmentHeader{segment_magic, segment_layout, capacity, {}, {0}}};
+    for (std::size_t slot{}; slot < slot_count; ++slot) {
+        header->slot_offsets[slot] = header_size + slot * slot_size;
+        new (static_cast<std::byte*>(data) + header->slot_offsets[slot]) SlotHeader{{0}, 0, 0, sizeof(SlotHeader)};
+    }
+    return SharedCurveStore{data, size, true};
+#else
+    return std::nullopt;
+#endif
+}
+
+std::optional<SharedCurveStore> SharedCurveStore::open(const std::string& name) {
+#ifdef __unix__
+    const int descriptor{shm_open(name.c_str(), O_RDONLY, 0)};
+    if (descriptor < 0) {
+        return std::nullopt;
+    }
+    struct stat status {};
+    const bool has_status{fstat(descriptor, &status) == 0};
+    const auto size{static_cast<std::size_t>(status.st_size)};
+    const bool has_size{has_status && size >= sizeof(SegmentHeader)};
+    void* data{has_size ? mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0) : MAP_FAILED};
+    close(descriptor);
+    if (data == MAP_FAILED) {
+        return std::nullopt;
+    }
+
+    // Checked before the store takes the mapping, so every slot lies within it
+    SharedCurveStore store{data, size, false};
+    const auto& header{store.get_header()};
+    if (header.magic != segment_magic || header.layout != segment_layout) {
+        return std::nullopt;
+    }
+    for (const auto offset : header.slot_offsets) {
+        const auto slot_end{offset + sizeof(SlotHeader) + header.capacity * sizeof(SharedCurveRecord)};
+        if (offset < sizeof(SegmentHeader) || slot_end > size) {
+            return std::nullopt;
+        }
+    }
+    return store;
+#else
+    return std::nullopt;
+#endif
+}
+
+bool SharedCurveStore::remove(const std::string& name) {
+#ifdef __unix__
+    return shm_unlink(name.c_str()) == 0;
+#else
+    return false;
+#endif
+}
+
+SharedCurveStore::SharedCurveStore(void* data, std::size_t size, bool writable)
+    : _data{data}, _size{size}, _writable{writable} {
+}
+
+SharedCurveStore::SharedCurveStore(SharedCurveStore&& other) noexcept
+    : _data{std::exchange(other._data, nullptr)}, _size{std::exchange(other._size, 0)}, _writable{other._writable} {
+}
+
+SharedCurveStore& SharedCurveStore::operator=(SharedCurveStore&& other) noexcept {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    std::swap(_writable, other._writable);
+    return *this;
+}
+
+SharedCurveStore::~SharedCurveStore() {
+#ifdef __unix__
+    if (_data) {
+        munmap(_data, _size);
+    }
+#endif
+}
+
+std::size_t SharedCurveStore::get_capacity() const {
+    return get_header().capacity;
+}
+
+std::uint64_t SharedCurveStore::get_version() const {
+    return get_header().version.load(std::memory_order_acquire);
+}
+
+std::optional<std::uint64_t> SharedCurveStore::publish(std::span<const std::shared_ptr<Curve>> curves) {
+    return publish(curves.size(), [&](std::size_t index) -> const Curve& { return *curves[index]; });
+}
+
+std::optional<std::uint64_t> SharedCurveStore::publish(const CurveStore& store) {
+    return publish(store.size(), [&](std::size_t index) -> const Curve& { return store[index]; });
+}
+
+std::optional<SharedCurveView> SharedCurveStore::get_snapshot() const {
+    const auto& header{get_header()};
+    for (std::size_t attempt{}; attempt < snapshot_attempts; ++attempt) {
+        const auto version{header.version.load(std::memory_order_acquire)};
+        if (version == 0) {
+            return std::nullopt;
+        }
+
+        const auto& slot{get_slot(version % slot_count)};
+        const auto sequence{slot.sequence.load(std::memory_order_acquire)};
+        // A newer version may already be in the slot, or the writer may be filling it
+        if (sequence % 2 != 0 || slot.version != version) {
+            continue;
+        }
+
+        const auto count{std::min(slot.count, header.capacity)};
+        const auto* records{reinterpret_cast<const SharedCurveRecord*>(
+            reinterpret_cast<const std::byte*>(&slot) + slot.records_offset)};
+        SharedCurveView view{&slot.sequence, sequence, version, {records, count}};
+        if (view.is_valid()) {
+            return view;
+        }
+    }
+    return std::nullopt;
+}
+
+const SharedCurveStore::SegmentHeader& SharedCurveStore::get_header() const {
+    return *static_cast<const SegmentHeader*>(_data);
+}
+
+SharedCurveStore::SlotHeader& SharedCurveStore::get_slot(std::size_t slot) const {
+    return *reinterpret_cast<SlotHeader*>(static_cast<std::byte*>(_data) + get_header().slot_offsets[slot]);
+}
+
+std::optional<std::uint64_t> SharedCurveStore::publish(
+    std::size_t count, const std::function<const Curve&(std::size_t)>& get_curve) {
+    auto& header{*static_cast<SegmentHeader*>(_data)};
+    if (!_writable || count > header.capacity) {
+        return std::nullopt;
+    }
+
+    // The slot not holding the latest snapshot, readers of that one are not disturbed
+    const auto version{header.version.load(std::memory_order_relaxed) + 1};
+    auto& slot{get_slot(version % slot_count)};
+    const auto sequence{slot.sequence.load(std::memory_order_relaxed)};
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto* records{reinterpret_cast<SharedCurveRecord*>(reinterpret_cast<std::byte*>(&slot) + slot.records_offset)};
+    std::size_t written{};
+    for (; written < count; ++written) {
+        const auto record{make_record(get_curve(written))};
+        if (!record) {
+            break;
+        }
+        records[written] = *record;
+    }
+    slot.count = written;
+    // A failed publication leaves the slot with an outdated version, readers never take it
+    slot.version = written == count ? version : 0;
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+
+    if (written != count) {
+        return std::nullopt;
+    }
+    header.version.store(version, std::memory_order_release);
+    return version;
+}
+
+MemoryUsage memory_usage(const SharedCurveStore& store) {
+    MemoryUsage usage;
+    if (store._data) {
+        usage.payload = slot_count * store.get_capacity() * sizeof(SharedCurveRecord);
+        usage.index = sizeof(SharedCurveStore::SegmentHeader) + slot_count * sizeof(SharedCurveStore::SlotHeader);
+        usage.allocator_overhead = store._size - usage.payload - usage.index;
+    }
+    return usage;
+}
+
+} // namespace model3d
+} // namespace curves
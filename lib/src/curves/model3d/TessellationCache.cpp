@@ -0,0 +1,165 @@
+#include "curves/model3d/TessellationCache.h"
+
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+#include "curves/model3d/Curve.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+// Bookkeeping of one entry besides the points: list node, hash map node and vector control data
+constexpr std::size_t entry_overhead{128};
+
+std::size_t get_entry_memory(const std::vector<Point3d>& points) {
+    return points.capacity() * sizeof(Point3d) + entry_overhead;
+}
+
+} // namespace
+
+TessellationCache::TessellationCache(std::size_t max_memory) : _max_memory{max_memory} {};
+
+TessellationCache::Points TessellationCache::get(const Curve& curve, double t0, double t1, double tolerance) {
+    const auto level{get_level(curve, t0, t1, tolerance)};
+    if (!level) {
+        return nullptr;
+    }
+    const Key key{curve.get_id(), t0, t1, *level};
+
+    {
+        std::lock_guard lock{_mutex};
+        if (auto points{find(key)}) {
+            return points;
+        }
+        if (auto points{derive_from_finer(key)}) {
+            insert(key, points);
+            return points;
+        }
+    }
+
+    // Evaluated without holding the lock, a concurrent request for the same key may do the same work
+    const std::size_t segments{std::size_t{1} << key.level};
+    auto points{std::make_shared<std::vector<Point3d>>(segments + 1)};
+    curve.sample_uniform(t0, (t1 - t0) / static_cast<double>(segments), *points);
+    points->back() = curve.get_point(t1); // Exact end point, free of the accumulated parameter rounding
+
+    std::lock_guard lock{_mutex};
+    if (auto cached{find(key)}) {
+        return cached;
+    }
+    insert(key, points);
+    return points;
+}
+
+void TessellationCache::invalidate(const Curve& curve) {
+    std::lock_guard lock{_mutex};
+    for (auto entry{_lru.begin()}; entry != _lru.end();) {
+        const auto current{entry++};
+        if (current->key.curve_id == curve.get_id()) {
+            erase(current);
+        }
+    }
+}
+
+void TessellationCache::clear() {
+    std::lock_guard lock{_mutex};
+    _entries.clear();
+    _lru.clear();
+    _memory_usage = 0;
+}
+
+std::size_t TessellationCache::get_memory_usage() const {
+    std::lock_guard lock{_mutex};
+    return _memory_usage;
+}
+
+std::size_t TessellationCache::get_size() const {
+    std::lock_guard lock{_mutex};
+    return _entries.size();
+}
+
+std::optional<std::uint32_t> TessellationCache::get_level(const Curve& curve, double t0, double t1, double tolerance) {
+    if (!(tolerance > 0.0)) {
+        return std::nullopt;
+    }
+
+    // Chord error of a segment with parameter length h: M * h^2 / 8 <= tolerance
+    const double acceleration{curve.get_max_acceleration()};
+    const double range{std::abs(t1 - t0)};
+    if (acceleration <= 0.0 || range <= 0.0) {
+        return 0;
+    }
+    if (!std::isfinite(acceleration) || !std::isfinite(range)) {
+        return max_level;
+    }
+
+    const double max_segment{std::sqrt(8.0 * tolerance / acceleration)};
+    const double segments{std::ceil(range / max_segment)};
+    const double level{std::ceil(std::log2(std::max(segments, 1.0)))};
+    return static_cast<std::uint32_t>(std::min(level, static_cast<double>(max_level)));
+}
+
+std::size_t TessellationCache::Key_hash::operator()(const Key& key) const {
+    std::size_t seed{std::hash<std::uint64_t>{}(key.curve_id)};
+    for (const std::size_t value : {std::hash<double>{}(key.t0), std::hash<double>{}(key.t1),
+             std::hash<std::uint32_t>{}(key.level)}) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+TessellationCache::Points TessellationCache::find(const Key& key) {
+    const auto found{_entries.find(key)};
+    if (found == _entries.end()) {
+        return nullptr;
+    }
+    _lru.splice(_lru.begin(), _lru, found->second);
+    return found->second->points;
+}
+
+TessellationCache::Points TessellationCache::derive_from_finer(const Key& key) {
+    for (std::uint32_t distance{1}; distance <= max_derivation_distance && key.level + distance <= max_level;
+         ++distance) {
+        const auto finer{find(Key{key.curve_id, key.t0, key.t1, key.level + distance})};
+        if (!finer) {
+            continue;
+        }
+
+        const std::size_t stride{std::size_t{1} << distance};
+        auto points{std::make_shared<std::vector<Point3d>>()};
+        points->reserve((std::size_t{1} << key.level) + 1);
+        for (std::size_t i{}; i < finer->size(); i += stride) {
+            points->push_back((*finer)[i]);
+        }
+        return points;
+    }
+    return nullptr;
+}
+
+void TessellationCache::insert(const Key& key, const Points& points) {
+    const auto memory{get_entry_memory(*points)};
+    if (memory > _max_memory) {
+        return;
+    }
+
+    _lru.push_front(Entry{key, points, memory});
+    _entries[key] = _lru.begin();
+    _memory_usage += memory;
+    evict();
+}
+
+void TessellationCache::erase(Lru_list::iterator entry) {
+    _memory_usage -= entry->memory;
+    _entries.erase(entry->key);
+    _lru.erase(entry);
+}
+
+void TessellationCache::evict() {
+    while (_memory_usage > _max_memory && !_lru.empty()) {
+        erase(std::prev(_lru.end()));
+    }
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,208 @@
+#include "curves/model3d/TubeMesh.h"
+
+#include "curves/math/LinearAlgebra.h"
+#include "curves/math/SinCosSequence.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/Trace.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+constexpr std::size_t curve_grain{16};
+
+// Parameters of a supported curve: P(t) = C + a * cos(t) * U + b * sin(t) * V + (h * t / 2pi) * N
+struct SweptCurve {
+    CurveFactory::Curve_type type;
+    Point3d center;
+    double size_a;
+    double size_b;
+    double step; // 0 unless a helix
+    Vector3d axis_x;
+    Vector3d axis_y;
+    Vector3d axis;
+};
+
+std::optional<SweptCurve> get_swept_curve(const Curve& curve) {
+    if (const auto* circle{dynamic_cast<const Circle*>(&curve)}) {
+        return SweptCurve{CurveFactory::Curve_type::circle, circle->get_center(), circle->get_radius(),
+            circle->get_radius(), 0.0, circle->get_axis_x(), circle->get_axis_y(), circle->get_axis()};
+    }
+    if (const auto* ellipse{dynamic_cast<const Ellipse*>(&curve)}) {
+        return SweptCurve{CurveFactory::Curve_type::ellipse, ellipse->get_center(), ellipse->get_radius_major(),
+            ellipse->get_radius_minor(), 0.0, ellipse->get_axis_x(), ellipse->get_axis_y(), ellipse->get_axis()};
+    }
+    if (const auto* helix{dynamic_cast<const Helix*>(&curve)}) {
+        return SweptCurve{CurveFactory::Curve_type::helix, helix->get_center(), helix->get_radius(),
+            helix->get_radius(), helix->get_step(), helix->get_axis_x(), helix->get_axis_y(), helix->get_axis()};
+    }
+    return std::nullopt;
+}
+
+TubeMeshSize get_size(const SweptCurve& curve, const TubeParameters& parameters) {
+    const double radius{parameters.profile_radius};
+    // The deviations across and along the tube add up inside a triangle, each gets half of the tolerance
+    const double tolerance{0.5 * parameters.tolerance};
+    if (!(radius > 0.0) || !(tolerance > 0.0)) {
+        return TubeMeshSize{0, 0};
+    }
+
+    std::uint32_t sides{3};
+    if (tolerance < radius) {
+        const double sides_needed{std::ceil(math::pi / std::acos(1.0 - tolerance / radius))};
+        sides = static_cast<std::uint32_t>(std::clamp(sides_needed, 3.0, static_cast<double>(max_tube_sides)));
+    }
+
+    const double larger{std::max(curve.size_a, curve.size_b)};
+    const double rotation_rate{larger / std::min(curve.size_a, curve.size_b)};
+    const double bend{larger + radius * rotation_rate * rotation_rate};
+    const double step{std::sqrt(8.0 * tolerance / bend)};
+    const double rings_needed{std::ceil(std::abs(parameters.t1 - parameters.t0) / step) + 1.0};
+    const auto rings{static_cast<std::uint32_t>(std::clamp(rings_needed, 2.0, static_cast<double>(max_tube_rings)))};
+    return TubeMeshSize{rings, sides};
+}
+
+// Ring center and the two unit vectors spanning the profile plane, e2 = e1 x T so that the triangles face outwards
+struct Ring {
+    Point3d center;
+    Vector3d e1;
+    Vector3d e2;
+};
+
+Ring get_ring(const SweptCurve& curve, double t, double cos, double sin) {
+    // Formula: P'(t) = -a * sin(t) * U + b * cos(t) * V + (h / 2pi) * N
+    const double rise{curve.step / math::two_pi};
+    const auto radial{curve.axis_x * (curve.size_a * cos) + curve.axis_y * (curve.size_b * sin)};
+    const auto center{math::translate(curve.center, radial + curve.axis * (rise * t))};
+    auto tangent{curve.axis_y * (curve.size_b * cos) - curve.axis_x * (curve.size_a * sin) + curve.axis * rise};
+    tangent.normalize();
+
+    if (curve.type == CurveFactory::Curve_type::helix) {
+        // Frenet frame: the principal normal points at the axis, the frame turns with t around the axis
+        const auto normal{(curve.axis_x * cos + curve.axis_y * sin) * -1.0};
+        return Ring{center, normal, math::cross_product(normal, tangent)};
+    }
+    // Plane curves: in-plane normal T x N, the plane normal completes the frame
+    return Ring{center, math::cross_product(tangent, curve.axis), curve.axis};
+}
+
+void write_mesh(const SweptCurve& curve,
+    const TubeParameters& parameters,
+    const TubeMeshSize& size,
+    std::size_t vertex_offset,
+    std::span<Point3d> positions,
+    std::span<Vector3d> normals,
+    std::span<std::uint32_t> indices) {
+    const std::uint32_t sides{size.sides};
+    thread_local std::vector<std::array<double, 2>> profile{};
+    profile.resize(sides);
+    math::SinCosSequence angle{0.0, math::two_pi / static_cast<double>(sides)};
+    for (auto& direction : profile) {
+        direction = {angle.cos(), angle.sin()};
+        angle.next();
+    }
+
+    const double dt{(parameters.t1 - parameters.t0) / static_cast<double>(size.rings - 1)};
+    math::SinCosSequence parameter{parameters.t0, dt};
+    for (std::uint32_t ring{}; ring < size.rings; ++ring) {
+        const auto frame{get_ring(curve, parameter.t(), parameter.cos(), parameter.sin())};
+        parameter.next();
+
+        const std::size_t first{std::size_t{ring} * sides};
+        for (std::uint32_t side{}; side < sides; ++side) {
+            const auto normal{frame.e1 * profile[side][0] + frame.e2 * profile[side][1]};
+            positions[first + side] = math::translate(frame.center, normal * parameters.profile_radius);
+            normals[first + side] = normal;
+        }
+    }
+
+    // Quad between side j and j + 1 of rings i and i + 1, two triangles counterclockwise from outside:
+    // t grows along the rings and the profile angle from e1 to e2, and T x e2 = e1 points outwards
+    std::size_t index{};
+    for (std::uint32_t ring{}; ring + 1 < size.rings; ++ring) {
+        const auto first{static_cast<std::uint32_t>(vertex_offset + std::size_t{ring} * sides)};
+        for (std::uint32_t side{}; side < sides; ++side) {
+            const std::uint32_t next_side{side + 1 == sides ? 0 : side + 1};
+            const std::uint32_t v00{first + side};
+            const std::uint32_t v01{first + next_side};
+            const std::uint32_t v10{v00 + sides};
+            const std::uint32_t v11{v01 + sides};
+            for (const auto vertex : {v00, v10, v01, v01, v10, v11}) {
+                indices[index++] = vertex;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TubeMeshSize get_tube_mesh_size(const Curve& curve, const TubeParameters& parameters) {
+    const auto swept{get_swept_curve(curve)};
+    return swept ? get_size(*swept, parameters) : TubeMeshSize{0, 0};
+}
+
+TubeMeshLayout get_tube_mesh_layout(
+    std::span<const std::shared_ptr<Curve>> curves, const TubeParameters& parameters) {
+    TubeMeshLayout layout;
+    layout.sizes.reserve(curves.size());
+    layout.vertex_offsets.reserve(curves.size() + 1);
+    layout.index_offsets.reserve(curves.size() + 1);
+    layout.vertex_offsets.push_back(0);
+    layout.index_offsets.push_back(0);
+    for (const auto& curve : curves) {
+        const auto size{get_tube_mesh_size(*curve, parameters)};
+        layout.sizes.push_back(size);
+        layout.vertex_offsets.push_back(layout.vertex_offsets.back() + size.get_vertex_count());
+        layout.index_offsets.push_back(layout.index_offsets.back() + size.get_index_count());
+    }
+    return layout;
+}
+
+bool write_tube_meshes(std::span<const std::shared_ptr<Curve>> curves,
+    const TubeParameters& parameters,
+    const TubeMeshLayout& layout,
+    const TubeMeshBuffers& buffers,
+    parallel::Executor* executor) {
+    parallel::TraceSpan span{"model3d::write_tube_meshes"};
+    const std::size_t vertex_count{layout.get_vertex_count()};
+    if (layout.sizes.size() != curves.size() || buffers.positions.size() < vertex_count
+        || buffers.normals.size() < vertex_count || buffers.indices.size() < layout.get_index_count()
+        || vertex_count > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    const auto write_range = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            const auto& size{layout.sizes[i]};
+            const auto swept{size.get_vertex_count() > 0 ? get_swept_curve(*curves[i]) : std::nullopt};
+            if (!swept) {
+                continue;
+            }
+            const auto vertex_offset{layout.vertex_offsets[i]};
+            write_mesh(*swept,
+                parameters,
+                size,
+                vertex_offset,
+                buffers.positions.subspan(vertex_offset, size.get_vertex_count()),
+                buffers.normals.subspan(vertex_offset, size.get_vertex_count()),
+                buffers.indices.subspan(layout.index_offsets[i], size.get_index_count()));
+        }
+    };
+
+    if (executor && curves.size() > curve_grain) {
+        executor->parallel_for(curves.size(), curve_grain, [&](std::size_t begin, std::size_t end, std::size_t) {
+            write_range(begin, end);
+        });
+    } else {
+        write_range(0, curves.size());
+    }
+    return true;
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,276 @@
+#include "curves/parallel/CurvePipeline.h"
+
+#include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/parallel/BoundedQueue.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+struct Source_chunk {
+    std::size_t sequence;
+    Curve_chunk curves;
+};
+
+struct Sorted_chunk {
+    std::size_t sequence;
+    std::size_t valid_count;
+    std::size_t selected_count;
+    double key_sum;
+    std::vector<KeyedCurve> smallest;
+};
+
+bool key_less(const KeyedCurve& first, const KeyedCurve& second) {
+    return first.key < second.key;
+}
+
+Sorted_chunk sort_chunk(Source_chunk&& chunk,
+    const Curve_predicate& select,
+    const Curve_key& key,
+    std::size_t keep_smallest) {
+    Sorted_chunk result{chunk.sequence, 0, 0, 0.0, {}};
+
+    std::vector<KeyedCurve> selected;
+    for (auto& curve : chunk.curves) {
+        if (!curve) {
+            continue;
+        }
+        ++result.valid_count;
+        if (!select(*curve)) {
+            continue;
+        }
+        const double value{key(*curve)};
+        result.key_sum += value;
+        if (keep_smallest > 0) {
+            selected.push_back({value, std::move(curve)});
+        }
+        ++result.selected_count;
+    }
+
+    // Only the prefix that can survive the reduction is sorted, equal keys keep the source order
+    const auto kept{std::min(keep_smallest, selected.size())};
+    std::vector<std::size_t> order(selected.size());
+    std::iota(order.begin(), order.end(), std::size_t{});
+    std::partial_sort(order.begin(), order.begin() + kept, order.end(), [&](std::size_t first, std::size_t second) {
+        return key_less(selected[first], selected[second]) ||
+               (!key_less(selected[second], selected[first]) && first < second);
+    });
+
+    result.smallest.reserve(kept);
+    for (std::size_t i{}; i < kept; ++i) {
+        result.smallest.push_back(std::move(selected[order[i]]));
+    }
+    return result;
+}
+
+void merge_smallest(std::vector<KeyedCurve>& smallest, std::vector<KeyedCurve>&& chunk, std::size_t keep_smallest) {
+    std::vector<KeyedCurve> merged;
+    merged.reserve(std::min(smallest.size() + chunk.size(), keep_smallest));
+    auto first{smallest.begin()};
+    auto second{chunk.begin()};
+    while (merged.size() < keep_smallest && (first != smallest.end() || second != chunk.end())) {
+        // Ties go to the earlier chunk
+        if (second == chunk.end() || (first != smallest.end() && !key_less(*second, *first))) {
+            merged.push_back(std::move(*first++));
+        } else {
+            merged.push_back(std::move(*second++));
+        }
+    }
+    smallest = std::move(merged);
+}
+
+// Back pressure of the reordering: a sorted chunk waits until it is less than size sequences ahead of the next
+// chunk to reduce, so the chunks waiting for a predecessor stay bounded however slow one chunk is.
+// The chunk with the next sequence never waits, so the reduction always progresses.
+class Reorder_window {
+public:
+    explicit Reorder_window(std::size_t size) : _size{std::max<std::size_t>(size, 1)} {};
+
+    // Waits until sequence is inside the window; false if the window is closed
+    bool wait(std::size_t sequence) {
+        std::unique_lock lock{_mutex};
+        _advanced.wait(lock, [&]() { return _closed || sequence < _next_sequence + _size; });
+        return !_closed;
+    };
+
+    void advance() {
+        {
+            std::lock_guard lock{_mutex};
+            ++_next_sequence;
+        }
+        _advanced.notify_all();
+    };
+
+    void close() {
+        {
+            std::lock_guard lock{_mutex};
+            _closed = true;
+        }
+        _advanced.notify_all();
+    };
+
+private:
+    const std::size_t _size;
+    std::mutex _mutex;
+    std::condition_variable _advanced;
+    std::size_t _next_sequence{};
+    bool _closed{false};
+};
+
+// Threads of the source and filter stages. The destructor stops the stages and joins, so that an exception
+// leaving the reduction (or a failed thread start) does not destroy a joinable thread.
+class Stage_threads {
+public:
+    explicit Stage_threads(std::function<void()> stop) : _stop{std::move(stop)} {};
+
+    Stage_threads(const Stage_threads& other) = delete;
+    Stage_threads& operator=(const Stage_threads& other) = delete;
+
+    ~Stage_threads() { join(); };
+
+    template <typename Function>
+    void start(Function&& function) {
+        _threads.emplace_back(std::forward<Function>(function));
+    };
+
+    // Stops the stages and waits for them; the stages have already finished after a complete reduction
+    void join() {
+        _stop();
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    };
+
+private:
+    std::function<void()> _stop;
+    std::vector<std::thread> _threads;
+};
+
+} // namespace
+
+Generator<Curve_chunk> generate_random_curves(std::size_t count, std::size_t chunk_size) {
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    for (std::size_t begin{}; begin < count; begin += chunk_size) {
+        Curve_chunk chunk;
+        chunk.reserve(std::min(chunk_size, count - begin));
+        for (std::size_t i{begin}; i < std::min(begin + chunk_size, count); ++i) {
+            chunk.push_back(model3d::CurveFactory::create_random_curve());
+        }
+        co_yield std::move(chunk);
+    }
+}
+
+PipelineResult run_pipeline(Generator<Curve_chunk> source,
+    const Curve_predicate& select,
+    const Curve_key& key,
+    const PipelineOptions& options,
+    JobControl* control) {
+    std::size_t filter_threads{options.filter_threads};
+    if (filter_threads == 0) {
+        filter_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 3) - 2;
+    }
+
+    BoundedQueue<Source_chunk> source_queue{options.queue_capacity};
+    BoundedQueue<Sorted_chunk> sorted_queue{options.queue_capacity};
+    // Chunks past the filters (sorted queue and reorder map) are within one window of the next sequence
+    Reorder_window window{options.queue_capacity};
+
+    const auto stop{[&]() {
+        source_queue.close();
+        sorted_queue.close();
+        window.close();
+    }};
+
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    const auto fail{[&](std::exception_ptr exception) {
+        {
+            std::lock_guard lock{error_mutex};
+            if (!error) {
+                error = exception;
+            }
+        }
+        stop();
+    }};
+
+    PipelineResult result;
+
+    // Declared after everything the threads use, so that it is destroyed (and joins) first
+    Stage_threads threads{stop};
+
+    threads.start([&]() {
+        try {
+            for (std::size_t sequence{};; ++sequence) {
+                if (control && control->is_cancelled()) {
+                    break;
+                }
+                auto chunk{source.next()};
+                if (!chunk) {
+                    break;
+                }
+                result.generated_count += chunk->size(); // Read only after the join
+                if (!source_queue.push(Source_chunk{sequence, std::move(*chunk)})) {
+                    break;
+                }
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+        source_queue.close();
+    });
+
+    std::atomic<std::size_t> running_filters{filter_threads};
+    for (std::size_t i{}; i < filter_threads; ++i) {
+        threads.start([&]() {
+            try {
+                while (auto chunk{source_queue.pop()}) {
+                    auto sorted{sort_chunk(std::move(*chunk), select, key, options.keep_smallest)};
+                    if (!window.wait(sorted.sequence) || !sorted_queue.push(std::move(sorted))) {
+                        break;
+                    }
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+            if (running_filters.fetch_sub(1) == 1) {
+                sorted_queue.close();
+            }
+        });
+    }
+
+    // Reduction in source order: chunks finished out of order wait until their predecessors arrive
+    std::unordered_map<std::size_t, Sorted_chunk> pending;
+    std::size_t next_sequence{};
+    while (auto chunk{sorted_queue.pop()}) {
+        pending.emplace(chunk->sequence, std::move(*chunk));
+        for (auto ready{pending.find(next_sequence)}; ready != pending.end(); ready = pending.find(next_sequence)) {
+            auto& item{ready->second};
+            result.valid_count += item.valid_count;
+            result.selected_count += item.selected_count;
+            result.key_sum += item.key_sum;
+            merge_smallest(result.smallest, std::move(item.smallest), options.keep_smallest);
+            pending.erase(ready);
+            ++next_sequence;
+            window.advance();
+        }
+
+        if (control && control->is_cancelled()) {
+            result.cancelled = true;
+            stop();
+        }
+    }
+
+    threads.join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    result.cancelled = result.cancelled || (control && control->is_cancelled());
+    return result;
+}
+
+} // namespace parallel
+} // namespace curves
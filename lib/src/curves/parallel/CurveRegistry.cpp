@@ -0,0 +1,270 @@
+#include "curves/parallel/CurveRegistry.h"
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+std::atomic<std::uint64_t> next_registry_id{0};
+
+constexpr std::uint64_t free_index_mask{0xFFFFFFFFULL};
+
+model3d::CurveFactory::Curve_type get_type(const model3d::Curve& curve) {
+    if (dynamic_cast<const model3d::Circle*>(&curve)) {
+        return model3d::CurveFactory::Curve_type::circle;
+    }
+    if (dynamic_cast<const model3d::Ellipse*>(&curve)) {
+        return model3d::CurveFactory::Curve_type::ellipse;
+    }
+    if (dynamic_cast<const model3d::Helix*>(&curve)) {
+        return model3d::CurveFactory::Curve_type::helix;
+    }
+    return model3d::CurveFactory::Curve_type::size;
+}
+
+} // namespace
+
+CurveRegistry::Guard::Guard(const CurveRegistry& registry)
+    : _registry{registry}, _participant{registry.get_participant()} {
+    _registry.enter(_participant);
+}
+
+CurveRegistry::Guard::~Guard() {
+    _registry.leave(_participant);
+}
+
+CurveRegistry::CurveRegistry() : _id{next_registry_id.fetch_add(1, std::memory_order_relaxed)}, _free_head{0} {};
+
+CurveRegistry::~CurveRegistry() {
+    for (auto& segment : _segments) {
+        if (const auto slots{segment.load(std::memory_order_acquire)}) {
+            for (std::uint32_t i{}; i < segment_size; ++i) {
+                delete slots[i].node.load(std::memory_order_relaxed);
+            }
+            delete[] slots;
+        }
+    }
+    for (auto node{_retired.load(std::memory_order_acquire)}; node;) {
+        delete std::exchange(node, node->next_retired);
+    }
+    for (auto participant{_participants.load(std::memory_order_acquire)}; participant;) {
+        delete std::exchange(participant, participant->next);
+    }
+}
+
+CurveHandle CurveRegistry::insert(std::shared_ptr<const model3d::Curve> curve) {
+    if (!curve) {
+        return {};
+    }
+    const auto index{allocate_slot()};
+    if (!index) {
+        return {};
+    }
+
+    const auto type{get_type(*curve)};
+    auto& slot{*find_slot(*index)};
+    slot.node.store(new Node{std::move(curve), type}, std::memory_order_release);
+    _size.fetch_add(1, std::memory_order_relaxed);
+    return CurveHandle{*index, slot.generation.load(std::memory_order_relaxed)};
+}
+
+bool CurveRegistry::remove(CurveHandle handle) {
+    const auto slot{handle.is_valid() ? find_slot(handle.get_index()) : nullptr};
+    if (!slot) {
+        return false;
+    }
+
+    // Bumping the generation claims the removal, only one of concurrent removers succeeds
+    auto generation{handle.get_generation()};
+    if (!slot->generation.compare_exchange_strong(generation, generation + 1, std::memory_order_acq_rel)) {
+        return false;
+    }
+    const auto node{slot->node.exchange(nullptr, std::memory_order_acq_rel)};
+    if (!node) { // A forged handle of a free slot: the slot is given up rather than put on the free list twice
+        return false;
+    }
+
+    // A slot whose generations are exhausted is never reused, its old handles stay invalid
+    if (generation + 1 <= CurveHandle::generation_mask) {
+        release_slot(handle.get_index());
+    }
+    _size.fetch_sub(1, std::memory_order_relaxed);
+    retire(node);
+    return true;
+}
+
+const model3d::Curve* CurveRegistry::get(CurveHandle handle, const Guard&) const {
+    const auto node{find_node(handle)};
+    return node ? node->curve.get() : nullptr;
+}
+
+std::shared_ptr<const model3d::Curve> CurveRegistry::get_shared(CurveHandle handle) const {
+    const Guard guard{*this};
+    const auto node{find_node(handle)};
+    return node ? node->curve : nullptr;
+}
+
+void CurveRegistry::for_each(model3d::CurveFactory::Curve_type type, const Guard&, const Visitor& visitor) const {
+    const auto count{std::min(_next_slot.load(std::memory_order_acquire), CurveHandle::max_index + 1)};
+    for (std::uint32_t index{}; index < count; ++index) {
+        const auto slot{find_slot(index)};
+        if (!slot) {
+            continue;
+        }
+        const auto generation{slot->generation.load(std::memory_order_acquire)};
+        const auto node{slot->node.load(std::memory_order_acquire)};
+        if (node && node->type == type && slot->generation.load(std::memory_order_acquire) == generation) {
+            visitor(CurveHandle{index, generation}, *node->curve);
+        }
+    }
+}
+
+void CurveRegistry::collect() {
+    try_advance_epoch();
+
+    // Nodes retired two epochs ago cannot be referenced by any guard any more
+    const auto epoch{_epoch.load(std::memory_order_seq_cst)};
+    Node* kept{nullptr};
+    for (auto node{_retired.exchange(nullptr, std::memory_order_acq_rel)}; node;) {
+        auto next{node->next_retired};
+        if (epoch >= node->retire_epoch + 2) {
+            delete node;
+        } else {
+            node->next_retired = kept;
+            kept = node;
+        }
+        node = next;
+    }
+
+    while (kept) {
+        auto next{kept->next_retired};
+        kept->next_retired = _retired.load(std::memory_order_relaxed);
+        while (!_retired.compare_exchange_weak(
+            kept->next_retired, kept, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        kept = next;
+    }
+}
+
+CurveRegistry::Slot* CurveRegistry::find_slot(std::uint32_t index) const {
+    if (index > CurveHandle::max_index) {
+        return nullptr;
+    }
+    const auto segment{_segments[index >> segment_bits].load(std::memory_order_acquire)};
+    return segment ? &segment[index & (segment_size - 1)] : nullptr;
+}
+
+const CurveRegistry::Node* CurveRegistry::find_node(CurveHandle handle) const {
+    const auto slot{handle.is_valid() ? find_slot(handle.get_index()) : nullptr};
+    if (!slot || slot->generation.load(std::memory_order_acquire) != handle.get_generation()) {
+        return nullptr;
+    }
+    // The generation is checked again: the slot may have been emptied and reused in between
+    const auto node{slot->node.load(std::memory_order_acquire)};
+    if (!node || slot->generation.load(std::memory_order_acquire) != handle.get_generation()) {
+        return nullptr;
+    }
+    return node;
+}
+
+std::optional<std::uint32_t> CurveRegistry::allocate_slot() {
+    // Free list first (Treiber stack, the tag protects against ABA)
+    auto head{_free_head.load(std::memory_order_acquire)};
+    while (head & free_index_mask) {
+        const auto index{static_cast<std::uint32_t>((head & free_index_mask) - 1)};
+        const std::uint64_t next{find_slot(index)->next_free.load(std::memory_order_relaxed)};
+        const std::uint64_t tag{(head >> 32) + 1};
+        if (_free_head.compare_exchange_weak(head, (tag << 32) | next, std::memory_order_acq_rel)) {
+            return index;
+        }
+    }
+
+    auto index{_next_slot.load(std::memory_order_relaxed)};
+    do {
+        if (index > CurveHandle::max_index) {
+            return std::nullopt;
+        }
+    } while (!_next_slot.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel));
+
+    auto& segment{_segments[index >> segment_bits]};
+    if (!segment.load(std::memory_order_acquire)) {
+        auto fresh{new Slot[segment_size]};
+        Slot* expected{nullptr};
+        if (!segment.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+            delete[] fresh;
+        }
+    }
+    return index;
+}
+
+void CurveRegistry::release_slot(std::uint32_t index) {
+    auto& slot{*find_slot(index)};
+    auto head{_free_head.load(std::memory_order_relaxed)};
+    std::uint64_t next_head{};
+    do {
+        slot.next_free.store(static_cast<std::uint32_t>(head & free_index_mask), std::memory_order_relaxed);
+        next_head = (((head >> 32) + 1) << 32) | (std::uint64_t{index} + 1);
+    } while (!_free_head.compare_exchange_weak(head, next_head, std::memory_order_acq_rel));
+}
+
+CurveRegistry::Participant* CurveRegistry::get_participant() const {
+    // One participant per thread and registry, found through a per-thread cache keyed by the registry id
+    thread_local std::vector<std::pair<std::uint64_t, Participant*>> cache;
+    for (const auto& [id, participant] : cache) {
+        if (id == _id) {
+            return participant;
+        }
+    }
+
+    auto participant{new Participant};
+    participant->next = _participants.load(std::memory_order_relaxed);
+    while (!_participants.compare_exchange_weak(
+        participant->next, participant, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    cache.emplace_back(_id, participant);
+    return participant;
+}
+
+void CurveRegistry::enter(Participant* participant) const {
+    if (participant->depth++ == 0) {
+        participant->epoch.store(_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst); // The slots are read only after the epoch is visible
+    }
+}
+
+void CurveRegistry::leave(Participant* participant) const {
+    if (--participant->depth == 0) {
+        participant->epoch.store(0, std::memory_order_release);
+    }
+}
+
+bool CurveRegistry::try_advance_epoch() const {
+    auto epoch{_epoch.load(std::memory_order_seq_cst)};
+    for (auto participant{_participants.load(std::memory_order_acquire)}; participant;
+         participant = participant->next) {
+        const auto participant_epoch{participant->epoch.load(std::memory_order_seq_cst)};
+        if (participant_epoch != 0 && participant_epoch != epoch) {
+            return false;
+        }
+    }
+    return _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+void CurveRegistry::retire(Node* node) {
+    node->retire_epoch = _epoch.load(std::memory_order_seq_cst);
+    node->next_retired = _retired.load(std::memory_order_relaxed);
+    while (!_retired.compare_exchange_weak(
+        node->next_retired, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+
+    if (_retired_since_collect.fetch_add(1, std::memory_order_relaxed) % retire_batch == retire_batch - 1) {
+        collect();
+    }
+}
+
+} // namespace parallel
+} // namespace curves
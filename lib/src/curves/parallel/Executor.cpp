@@ -0,0 +1,146 @@
+#include "curves/parallel/Executor.h"
+
+#include "curves/parallel/NumaTopology.h"
+#include "curves/parallel/Trace.h"
+
+namespace curves {
+namespace parallel {
+
+Executor::Executor(std::size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    const auto& topology{NumaTopology::get()};
+    _worker_nodes.reserve(thread_count);
+    _node_has_workers.assign(topology.get_node_count(), false);
+    for (std::size_t i{}; i < thread_count; ++i) {
+        _worker_nodes.push_back(i % topology.get_node_count());
+        _node_has_workers[_worker_nodes.back()] = true;
+    }
+
+    _threads.reserve(thread_count);
+    for (std::size_t i{}; i < thread_count; ++i) {
+        _threads.emplace_back(&Executor::worker_loop, this, i);
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard lock{_mutex};
+        _stop = true;
+    }
+    _job_ready.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void Executor::parallel_for(std::size_t count, std::size_t grain, const Range_task& task) {
+    const Partition partition{0, count};
+    parallel_for_partitions(std::span{&partition, 1},
+        grain,
+        [&task](std::size_t, std::size_t begin, std::size_t end, std::size_t worker_index) {
+            task(begin, end, worker_index);
+        });
+}
+
+void Executor::parallel_for_partitions(
+    std::span<const Partition> partitions, std::size_t grain, const Partition_task& task) {
+    if (std::none_of(partitions.begin(), partitions.end(), [](const Partition& item) { return item.count > 0; })) {
+        return;
+    }
+
+    TraceSpan span{"Executor::parallel_for"};
+    std::lock_guard submit_lock{_submit_mutex};
+    std::unique_lock lock{_mutex};
+
+    _task = &task;
+    _partitions = partitions;
+    _grain = std::max<std::size_t>(grain, 1);
+    _next_chunks = std::vector<std::atomic<std::size_t>>(partitions.size());
+    _busy_workers = _threads.size();
+    _error = nullptr;
+    _failed.store(false, std::memory_order_relaxed);
+    ++_job_generation;
+    _job_ready.notify_all();
+
+    _job_done.wait(lock, [this]() { return _busy_workers == 0; });
+    _task = nullptr;
+    _partitions = {};
+    if (_error) {
+        std::rethrow_exception(std::exchange(_error, nullptr));
+    }
+}
+
+void Executor::worker_loop(std::size_t worker_index) {
+    const auto& topology{NumaTopology::get()};
+    const auto node{_worker_nodes[worker_index]};
+    if (topology.is_numa()) {
+        topology.pin_thread(node);
+    }
+
+    std::uint64_t seen_generation{};
+
+    while (true) {
+        std::unique_lock lock{_mutex};
+        _job_ready.wait(lock, [&]() { return _stop || _job_generation != seen_generation; });
+        if (_stop) {
+            return;
+        }
+        seen_generation = _job_generation;
+        const auto partition_count{_partitions.size()};
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            TraceSpan span{"Executor::worker"};
+            // Node-local partitions first, then the other nodes
+            for (const bool local : {true, false}) {
+                for (std::size_t partition{}; partition < partition_count; ++partition) {
+                    if (can_run(_partitions[partition], node, local)) {
+                        run_partition(partition, worker_index);
+                    }
+                }
+            }
+        } catch (...) {
+            error = std::current_exception();
+            _failed.store(true, std::memory_order_relaxed);
+        }
+
+        lock.lock();
+        if (error && !_error) {
+            _error = error;
+        }
+        if (--_busy_workers == 0) {
+            _job_done.notify_one();
+        }
+    }
+}
+
+bool Executor::can_run(const Partition& partition, std::size_t node, bool local) const {
+    const auto partition_node{partition.node % _node_has_workers.size()};
+    if (partition_node == node) {
+        return local;
+    }
+    return !local && (!partition.node_bound || !_node_has_workers[partition_node]);
+}
+
+void Executor::run_partition(std::size_t partition, std::size_t worker_index) {
+    const auto& task{*_task};
+    const auto count{_partitions[partition].count};
+    const auto grain{_grain};
+    auto& next_chunk{_next_chunks[partition]};
+
+    const std::size_t chunk_count{(count + grain - 1) / grain};
+    for (auto chunk{next_chunk.fetch_add(1, std::memory_order_relaxed)};
+         chunk < chunk_count && !_failed.load(std::memory_order_relaxed);
+         chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+        const std::size_t begin{chunk * grain};
+        task(partition, begin, std::min(begin + grain, count), worker_index);
+    }
+}
+
+} // namespace parallel
+} // namespace curves
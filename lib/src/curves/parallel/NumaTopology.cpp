@@ -0,0 +1,118 @@
+#include "curves/parallel/NumaTopology.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+constexpr const char* node_directory{"/sys/devices/system/node/"};
+
+std::optional<std::string> read_line(const std::string& path) {
+    std::ifstream file{path};
+    std::string line;
+    if (!file || !std::getline(file, line)) {
+        return std::nullopt;
+    }
+    return line;
+}
+
+} // namespace
+
+const NumaTopology& NumaTopology::get() {
+    static const NumaTopology topology;
+    return topology;
+}
+
+NumaTopology::NumaTopology() {
+    if (const auto online{read_line(std::string{node_directory} + "online")}) {
+        for (const auto node : parse_list(*online)) {
+            const auto cpu_list{read_line(std::string{node_directory} + "node" + std::to_string(node) + "/cpulist")};
+            auto cpus{cpu_list ? parse_list(*cpu_list) : std::vector<std::size_t>{}};
+            if (!cpus.empty()) { // Memory-only nodes get no workers
+                _cpus.push_back(std::move(cpus));
+                _node_ids.push_back(node);
+            }
+        }
+    }
+
+    if (_cpus.empty()) {
+        _cpus.emplace_back();
+        _node_ids.push_back(0);
+    }
+}
+
+bool NumaTopology::pin_thread(std::size_t node) const {
+#ifdef __linux__
+    const auto cpus{get_cpus(node)};
+    if (cpus.empty()) {
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool NumaTopology::prefer_node(const void* data, std::size_t size, std::size_t node) const {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (!is_numa() || size == 0) {
+        return false;
+    }
+
+    // <numaif.h> is part of libnuma, not of the kernel headers
+    constexpr int mpol_preferred{1};
+    constexpr unsigned mpol_mf_move{1U << 1};
+    const auto node_id{_node_ids[node % _node_ids.size()]};
+    constexpr std::size_t mask_bits{8 * sizeof(unsigned long)};
+    std::vector<unsigned long> mask(node_id / mask_bits + 1);
+    mask[node_id / mask_bits] = 1UL << (node_id % mask_bits);
+
+    // mbind works on whole pages
+    const auto page{static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE))};
+    const auto begin{reinterpret_cast<std::uintptr_t>(data) / page * page};
+    const auto end{reinterpret_cast<std::uintptr_t>(data) + size};
+    const auto mask_size{mask.size() * mask_bits + 1};
+    return syscall(SYS_mbind, begin, end - begin, mpol_preferred, mask.data(), mask_size, mpol_mf_move) == 0;
+#else
+    return false;
+#endif
+}
+
+std::vector<std::size_t> NumaTopology::parse_list(const std::string& list) {
+    std::vector<std::size_t> result;
+    std::size_t position{};
+    while (position < list.size()) {
+        const auto end{std::min(list.find(',', position), list.size())};
+        const auto item{list.substr(position, end - position)};
+        position = end + 1;
+
+        try {
+            const auto dash{item.find('-')};
+            const std::size_t first{std::stoul(item.substr(0, dash))};
+            const std::size_t last{dash == std::string::npos ? first : std::stoul(item.substr(dash + 1))};
+            for (std::size_t value{first}; value <= last; ++value) {
+                result.push_back(value);
+            }
+        } catch (const std::exception&) { // Blank or malformed item
+        }
+    }
+    return result;
+}
+
+} // namespace parallel
+} // namespace curves
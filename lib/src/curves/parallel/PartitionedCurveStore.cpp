@@ -0,0 +1,64 @@
+#include "curves/parallel/PartitionedCurveStore.h"
+
+#include "curves/parallel/NumaTopology.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+template <typename T>
+void prefer_node(std::span<const T> items, std::size_t node) {
+    NumaTopology::get().prefer_node(items.data(), items.size_bytes(), node);
+}
+
+void prefer_node(const model3d::CurveStore& store, std::size_t node) {
+    prefer_node(store.get_circles(), node);
+    prefer_node(store.get_ellipses(), node);
+    prefer_node(store.get_helices(), node);
+    prefer_node(store.get_entries(), node);
+}
+
+} // namespace
+
+std::optional<PartitionedCurveStore> PartitionedCurveStore::build(
+    std::span<const std::shared_ptr<model3d::Curve>> curves, Executor& executor) {
+    const std::size_t node_count{NumaTopology::get().get_node_count()};
+
+    PartitionedCurveStore result;
+    result._size = curves.size();
+    result._stores.resize(node_count);
+    for (std::size_t node{}; node < node_count; ++node) {
+        const std::size_t begin{curves.size() * node / node_count};
+        const std::size_t end{curves.size() * (node + 1) / node_count};
+        result._offsets.push_back(begin);
+        result._partitions.push_back({node, end - begin});
+    }
+
+    // One build job per node, run by a worker of that node only
+    std::vector<Partition> build_jobs;
+    for (std::size_t node{}; node < node_count; ++node) {
+        build_jobs.push_back({node, 1, true});
+    }
+
+    std::atomic<bool> failed{false};
+    executor.parallel_for_partitions(
+        build_jobs, 1, [&](std::size_t partition, std::size_t, std::size_t, std::size_t) {
+            auto store{model3d::CurveStore::compact(
+                curves.subspan(result._offsets[partition], result._partitions[partition].count))};
+            if (store) {
+                result._stores[partition] = std::move(*store);
+                prefer_node(result._stores[partition], partition);
+            } else {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        });
+
+    if (failed.load(std::memory_order_relaxed)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+} // namespace parallel
+} // namespace curves
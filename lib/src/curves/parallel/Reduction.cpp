@@ -0,0 +1,33 @@
+#include "curves/parallel/Reduction.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+CompensatedSum combine_range(std::span<const CompensatedSum> block_sums) {
+    if (block_sums.size() == 1) {
+        return block_sums.front();
+    }
+
+    const std::size_t half{block_sums.size() / 2};
+    auto result{combine_range(block_sums.first(half))};
+    result += combine_range(block_sums.subspan(half));
+    return result;
+}
+
+} // namespace
+
+double combine_block_sums(std::span<const CompensatedSum> block_sums) {
+    if (block_sums.empty()) {
+        return 0.0;
+    }
+    return combine_range(block_sums).get_value();
+}
+
+double sum(std::span<const double> values, Executor* executor) {
+    return sum(values, [](double value) { return value; }, executor);
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,190 @@
+#include "curves/parallel/Trace.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+const auto trace_epoch{std::chrono::steady_clock::now()};
+
+void write_json_string(std::ostream& stream, const char* text) {
+    stream << '"';
+    for (const char* c{text}; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            stream << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            stream << ' ';
+        } else {
+            stream << *c;
+        }
+    }
+    stream << '"';
+}
+
+// The format counts in microseconds, the fraction keeps the nanoseconds
+void write_microseconds(std::ostream& stream, std::uint64_t nanoseconds) {
+    const auto fraction{nanoseconds % 1000};
+    stream << nanoseconds / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+           << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+}
+
+} // namespace
+
+struct Tracer::ThreadBuffer {
+    std::mutex mutex; // Taken by the owning thread per event and by readers, so it is practically uncontended
+    std::vector<TraceEvent> events;
+    std::uint64_t written{};
+    std::uint32_t thread_id{};
+};
+
+// Holds the buffer of a thread and hands it back when the thread ends
+class Tracer::BufferLease {
+public:
+    ~BufferLease() {
+        if (_buffer) {
+            Tracer::get().release_buffer(*_buffer);
+        }
+    };
+
+    ThreadBuffer& get() {
+        if (!_buffer) {
+            _buffer = &Tracer::get().acquire_buffer();
+        }
+        return *_buffer;
+    };
+
+private:
+    ThreadBuffer* _buffer{nullptr};
+};
+
+std::atomic<bool> Tracer::_enabled{false};
+
+Tracer& Tracer::get() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer() = default;
+
+Tracer::~Tracer() = default;
+
+std::uint64_t Tracer::now() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch).count());
+}
+
+void Tracer::set_capacity(std::size_t capacity) {
+    std::lock_guard lock{_mutex};
+    _capacity = std::max<std::size_t>(capacity, 1);
+    for (const auto& buffer : _buffers) {
+        std::lock_guard buffer_lock{buffer->mutex};
+        buffer->events.assign(_capacity, TraceEvent{});
+        buffer->written = 0;
+    }
+}
+
+std::size_t Tracer::get_capacity() const {
+    std::lock_guard lock{_mutex};
+    return _capacity;
+}
+
+void Tracer::clear() {
+    std::lock_guard lock{_mutex};
+    for (const auto& buffer : _buffers) {
+        std::lock_guard buffer_lock{buffer->mutex};
+        buffer->written = 0;
+    }
+}
+
+void Tracer::record(const char* name, std::uint64_t start, std::uint64_t end) {
+    thread_local BufferLease lease;
+    auto& buffer{lease.get()};
+
+    std::lock_guard lock{buffer.mutex};
+    buffer.events[buffer.written % buffer.events.size()] = {name, start, end - start, buffer.thread_id};
+    ++buffer.written;
+}
+
+std::vector<TraceEvent> Tracer::get_events() const {
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard lock{_mutex};
+        for (const auto& buffer : _buffers) {
+            std::lock_guard buffer_lock{buffer->mutex};
+            const std::size_t capacity{buffer->events.size()};
+            const std::uint64_t first{buffer->written > capacity ? buffer->written - capacity : 0};
+            for (std::uint64_t i{first}; i < buffer->written; ++i) {
+                events.push_back(buffer->events[i % capacity]);
+            }
+        }
+    }
+
+    // A parent starting at the same time as its child comes first
+    std::sort(events.begin(), events.end(), [](const TraceEvent& first, const TraceEvent& second) {
+        return std::tie(first.start, second.duration, first.thread_id)
+            < std::tie(second.start, first.duration, second.thread_id);
+    });
+    return events;
+}
+
+std::uint64_t Tracer::get_dropped_count() const {
+    std::lock_guard lock{_mutex};
+    std::uint64_t dropped{};
+    for (const auto& buffer : _buffers) {
+        std::lock_guard buffer_lock{buffer->mutex};
+        dropped += buffer->written - std::min<std::uint64_t>(buffer->written, buffer->events.size());
+    }
+    return dropped;
+}
+
+void Tracer::write_chrome_trace(std::ostream& stream) const {
+    // Complete events ("ph": "X") carry the start and the duration in one record
+    stream << "{\"traceEvents\":[";
+    bool first{true};
+    for (const auto& event : get_events()) {
+        stream << (first ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(stream, event.name);
+        stream << ",\"cat\":\"curves\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread_id << ",\"ts\":";
+        write_microseconds(stream, event.start);
+        stream << ",\"dur\":";
+        write_microseconds(stream, event.duration);
+        stream << '}';
+        first = false;
+    }
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+bool Tracer::write_chrome_trace(const std::string& path) const {
+    std::ofstream stream{path};
+    if (!stream) {
+        return false;
+    }
+    write_chrome_trace(stream);
+    return static_cast<bool>(stream);
+}
+
+Tracer::ThreadBuffer& Tracer::acquire_buffer() {
+    std::lock_guard lock{_mutex};
+    ThreadBuffer* buffer{nullptr};
+    if (_free_buffers.empty()) {
+        _buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = _buffers.back().get();
+        buffer->events.assign(_capacity, TraceEvent{});
+    } else {
+        // The events of the previous thread stay, they carry its id
+        buffer = _free_buffers.back();
+        _free_buffers.pop_back();
+    }
+
+    std::lock_guard buffer_lock{buffer->mutex};
+    buffer->thread_id = _next_thread_id++;
+    return *buffer;
+}
+
+void Tracer::release_buffer(ThreadBuffer& buffer) {
+    std::lock_guard lock{_mutex};
+    _free_buffers.push_back(&buffer);
+}
+
+} // namespace parallel
+} // namespace curves
@@ -77,5 +77,55 @@ TEST_F(Circle_test, get_first_derivative) {
     }
 }
 
+TEST_F(Circle_test, sample_uniform) {
+    EXPECT_NE(circle, nullptr);
+
+    const double t0{-3.0};
+    const double dt{0.01};
+    std::vector<Point3d> points(1000);
+    circle->sample_uniform(t0, dt, points);
+
+    for (std::size_t i{}; i < points.size(); ++i) {
+        const auto& calibration_point{circle->get_point(t0 + static_cast<double>(i) * dt)};
+        EXPECT_TRUE(math::equal(points[i], calibration_point, math::sqr_precision));
+    }
+}
+
+TEST(Circle_large_test, sample_uniform_accuracy) {
+    const auto& circle{CurveFactory::create_circle(Point3d{1.0, -2.0, 3.0}, 999999.9, Vector3d{1.0, 2.0, 3.0})};
+    EXPECT_NE(circle, nullptr);
+
+    const double dt{math::two_pi / 100000.0};
+    std::vector<Point3d> points(100000);
+    circle->sample_uniform(0.0, dt, points);
+
+    for (std::size_t i{}; i < points.size(); ++i) {
+        const auto& calibration_point{circle->get_point(static_cast<double>(i) * dt)};
+        EXPECT_TRUE(math::equal(points[i], calibration_point, math::precision));
+    }
+}
+
+TEST_F(Circle_test, evaluate) {
+    const std::array<double, 4> parameters{-2.5, 0.0, 1.0, 40.0};
+    std::array<CurveEvaluation, 4> batch;
+    circle->evaluate(parameters, 2, batch);
+
+    for (std::size_t i{}; i < parameters.size(); ++i) {
+        const double t{parameters[i]};
+        const auto evaluation{circle->evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.point, circle->get_point(t), 0.0));
+        EXPECT_TRUE(math::equal(evaluation.first_derivative, circle->get_first_derivative(t), 0.0));
+        EXPECT_TRUE(math::equal(batch[i].point, evaluation.point, 0.0));
+        EXPECT_TRUE(math::equal(batch[i].second_derivative, evaluation.second_derivative, 0.0));
+
+        // Generic numeric second derivative
+        const auto numeric{circle->Curve::evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.second_derivative, numeric.second_derivative, 1e-6));
+    }
+
+    const auto point_only{circle->evaluate(1.0, 0)};
+    EXPECT_TRUE(math::equal(point_only.first_derivative, Vector3d{0.0, 0.0, 0.0}, 0.0));
+}
+
 } // namespace model3d
 } // namespace curves
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CompactCurveBlock.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace model3d {
+
+class CompactCurveBlock_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        curves.push_back(CurveFactory::create_circle(Point3d{1.0, -2.0, 3.0}, 5.0, Vector3d{1.0, 2.0, 3.0}));
+        curves.push_back(
+            CurveFactory::create_ellipse(Point3d{-40.0, 7.5, 0.25}, 12.0, 3.0, Vector3d{-1.0, 0.0, 0.2}));
+        curves.push_back(CurveFactory::create_helix(Point3d{100.0, 50.0, -20.0}, 2.0, 0.7, Vector3d{0.3, -0.4, 1.0}));
+    }
+
+    // Bound from the class description for |t| <= 2pi
+    static double get_bound(const CompactCurveBlock& block, double size, double height) {
+        return 3.0 * max_error + block.get_frame_error() * (size + std::abs(height));
+    }
+
+    static constexpr double max_error{1e-4};
+    std::vector<std::shared_ptr<Curve>> curves;
+};
+
+TEST_F(CompactCurveBlock_test, encode) {
+    const auto block{CompactCurveBlock::encode(curves, max_error)};
+    ASSERT_TRUE(block);
+    ASSERT_EQ(block->size(), 3);
+    EXPECT_EQ(block->get_type(0), CurveFactory::Curve_type::circle);
+    EXPECT_EQ(block->get_type(1), CurveFactory::Curve_type::ellipse);
+    EXPECT_EQ(block->get_type(2), CurveFactory::Curve_type::helix);
+    EXPECT_GT(block->get_frame_error(), 0.0);
+    EXPECT_LE(block->get_frame_error(), CompactCurveBlock::frame_angular_error);
+
+    const std::array<double, 3> sizes{5.0, 12.0, 2.0};
+    const std::array<double, 3> heights{0.0, 0.0, 0.7};
+    for (std::size_t i{}; i < curves.size(); ++i) {
+        for (double t{-math::two_pi}; t <= math::two_pi; t += 0.37) {
+            const double distance{std::sqrt(math::get_sqr_distance(block->get_point(i, t), curves[i]->get_point(t)))};
+            EXPECT_LE(distance, get_bound(*block, sizes[i], heights[i])) << "curve " << i << " t " << t;
+
+            const auto derivative_error{block->get_first_derivative(i, t) - curves[i]->get_first_derivative(t)};
+            EXPECT_LE(derivative_error.get_magnitude(), get_bound(*block, sizes[i], heights[i]));
+        }
+    }
+}
+
+TEST_F(CompactCurveBlock_test, decode) {
+    const auto block{CompactCurveBlock::encode(curves, max_error)};
+    ASSERT_TRUE(block);
+
+    const auto helix{std::dynamic_pointer_cast<Helix>(block->decode(2))};
+    ASSERT_TRUE(helix);
+    EXPECT_NEAR(helix->get_radius(), 2.0, max_error);
+    EXPECT_NEAR(helix->get_step(), 0.7, max_error);
+    EXPECT_LE(std::sqrt(math::get_sqr_distance(helix->get_center(), Point3d{100.0, 50.0, -20.0})), max_error);
+    EXPECT_TRUE(math::equal(helix->get_point(1.0), block->get_point(2, 1.0), math::precision));
+
+    EXPECT_TRUE(std::dynamic_pointer_cast<Circle>(block->decode(0)));
+    EXPECT_TRUE(std::dynamic_pointer_cast<Ellipse>(block->decode(1)));
+}
+
+TEST_F(CompactCurveBlock_test, unreachable_error) {
+    // 32-bit codes cannot cover a 1e6 wide block with 1e-9 steps
+    curves.push_back(CurveFactory::create_circle(Point3d{1e6, 0.0, 0.0}, 1.0, Vector3d{0.0, 0.0, 1.0}));
+    EXPECT_FALSE(CompactCurveBlock::encode(curves, 1e-9));
+    EXPECT_TRUE(CompactCurveBlock::encode(curves, 1e-3));
+}
+
+TEST_F(CompactCurveBlock_test, write_read) {
+    const auto block{CompactCurveBlock::encode(curves, max_error)};
+    ASSERT_TRUE(block);
+
+    std::stringstream stream;
+    block->write(stream);
+    const auto restored{CompactCurveBlock::read(stream)};
+    ASSERT_TRUE(restored);
+    ASSERT_EQ(restored->size(), block->size());
+    for (std::size_t i{}; i < block->size(); ++i) {
+        EXPECT_TRUE(math::equal(restored->get_point(i, 0.5), block->get_point(i, 0.5), 0.0));
+        EXPECT_EQ(restored->get_curves()[i].reserved, (std::array<std::uint8_t, 3>{}));
+    }
+    EXPECT_EQ(restored->get_frame_error(), block->get_frame_error());
+
+    // Truncated
+    std::stringstream truncated{stream.str().substr(0, 40)};
+    EXPECT_FALSE(CompactCurveBlock::read(truncated));
+
+    // A corrupt count larger than the stream, the count precedes the records
+    auto corrupt{stream.str()};
+    const std::uint64_t huge_count{std::uint64_t{1} << 60};
+    corrupt.replace(corrupt.size() - block->size() * sizeof(CompactCurve) - sizeof(huge_count),
+        sizeof(huge_count),
+        reinterpret_cast<const char*>(&huge_count),
+        sizeof(huge_count));
+    std::stringstream corrupt_stream{corrupt};
+    EXPECT_FALSE(CompactCurveBlock::read(corrupt_stream));
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "curves/intersection3d/CurveDistance.h"
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace intersection3d {
+
+using model3d::CurveFactory;
+using model3d::Vector3d;
+
+class CurveDistance_test : public ::testing::Test {
+protected:
+    static double get_distance(const model3d::Curve& first, const model3d::Curve& second, const CurveDistance& result) {
+        return std::sqrt(math::get_sqr_distance(first.get_point(result.t_a), second.get_point(result.t_b)));
+    }
+
+    // Upper bound of the minimum distance by dense sampling
+    static double get_sampled_distance(const model3d::Curve& first,
+        const ParameterRange& first_range,
+        const model3d::Curve& second,
+        const ParameterRange& second_range,
+        std::size_t sample_count) {
+        std::vector<Point3d> second_points;
+        for (std::size_t j{}; j <= sample_count; ++j) {
+            second_points.push_back(second.get_point(
+                second_range.min + (second_range.max - second_range.min) * static_cast<double>(j) / sample_count));
+        }
+
+        double result{std::numeric_limits<double>::infinity()};
+        for (std::size_t i{}; i <= sample_count; ++i) {
+            const auto point{first.get_point(
+                first_range.min + (first_range.max - first_range.min) * static_cast<double>(i) / sample_count)};
+            for (const auto& second_point : second_points) {
+                result = std::min(result, math::get_sqr_distance(point, second_point));
+            }
+        }
+        return std::sqrt(result);
+    }
+
+    const Vector3d z_axis{0.0, 0.0, 1.0};
+};
+
+TEST_F(CurveDistance_test, closed_forms) {
+    const auto& first{CurveFactory::create_circle(Point3d{1.0, 2.0, 0.0}, 2.0, z_axis)};
+    const auto& second{CurveFactory::create_circle(Point3d{1.0, 2.0, 4.0}, 5.0, z_axis * -1.0)};
+    const auto circles{get_min_distance(*first, *second)};
+    EXPECT_NEAR(circles.distance, 5.0, math::precision);
+    EXPECT_NEAR(get_distance(*first, *second, circles), circles.distance, math::precision);
+
+    const auto& helix{CurveFactory::create_helix(Point3d{1.0, 2.0, -10.0}, 2.0, 4.0, z_axis)};
+    const auto& circle{CurveFactory::create_circle(Point3d{1.0, 2.0, 1.0}, 5.0, z_axis)};
+    const auto helix_circle{get_min_distance(*helix, *circle)};
+    EXPECT_NEAR(helix_circle.distance, 3.0, math::precision);
+    EXPECT_NEAR(get_distance(*helix, *circle, helix_circle), 3.0, math::precision);
+    EXPECT_NEAR(helix_circle.t_a, 11.0 * math::two_pi / 4.0, math::precision);
+
+    // The closest helix point is the range end nearest to the circle plane
+    const auto clamped{get_min_distance(*circle, *helix, math::precision, ParameterRange{0.0, math::two_pi})};
+    EXPECT_NEAR(clamped.distance, std::sqrt(9.0 + 49.0), math::precision);
+    EXPECT_NEAR(clamped.t_b, math::two_pi, math::precision);
+}
+
+TEST_F(CurveDistance_test, perpendicular_circles) {
+    const auto& first{CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, z_axis)};
+    const auto& second{CurveFactory::create_circle(Point3d{3.0, 0.0, 0.0}, 1.0, Vector3d{0.0, 1.0, 0.0})};
+    const auto result{get_min_distance(*first, *second)};
+    EXPECT_NEAR(result.distance, 1.0, math::precision);
+    EXPECT_TRUE(math::equal(first->get_point(result.t_a), Point3d{1.0, 0.0, 0.0}, 1e-2));
+    EXPECT_TRUE(math::equal(second->get_point(result.t_b), Point3d{2.0, 0.0, 0.0}, 1e-2));
+
+    EXPECT_TRUE(is_closer_than(*first, *second, 1.5));
+    EXPECT_FALSE(is_closer_than(*first, *second, 0.5));
+    EXPECT_FALSE(is_closer_than(*first, *second, 0.99));
+}
+
+TEST_F(CurveDistance_test, matches_sampling) {
+    std::mt19937_64 generator{11};
+    std::uniform_real_distribution<double> coordinate{-3.0, 3.0};
+    std::uniform_real_distribution<double> radius{0.5, 3.0};
+    const auto get_vector = [&]() {
+        return Vector3d{coordinate(generator), coordinate(generator), coordinate(generator)};
+    };
+    const ParameterRange full_turn{0.0, math::two_pi};
+
+    for (std::size_t i{}; i < 10; ++i) {
+        const auto& circle{
+            CurveFactory::create_circle(Point3d{get_vector().data()}, radius(generator), get_vector())};
+        const auto& ellipse{CurveFactory::create_ellipse(
+            Point3d{get_vector().data()}, 3.5, radius(generator), get_vector())};
+        ASSERT_NE(circle, nullptr);
+        ASSERT_NE(ellipse, nullptr);
+
+        const auto result{get_min_distance(*circle, *ellipse)};
+        const double sampled{get_sampled_distance(*circle, full_turn, *ellipse, full_turn, 1000)};
+        EXPECT_NEAR(get_distance(*circle, *ellipse, result), result.distance, 1e-12);
+        EXPECT_LE(result.distance, sampled + math::precision) << i;
+        EXPECT_GE(result.distance, sampled - 1e-3) << i;
+        EXPECT_EQ(is_closer_than(*circle, *ellipse, result.distance + 1e-3), true) << i;
+        EXPECT_EQ(is_closer_than(*circle, *ellipse, result.distance - 1e-3), false) << i;
+    }
+}
+
+TEST_F(CurveDistance_test, unbounded_helix) {
+    const auto& helix{CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 1.0, 1.0, z_axis)};
+    const auto& ellipse{CurveFactory::create_ellipse(
+        Point3d{0.0, 0.0, 100.0}, 3.0, 2.0, Vector3d{0.1, 0.0, 1.0}, Vector3d{1.0, 0.0, -0.1})};
+    ASSERT_NE(helix, nullptr);
+    ASSERT_NE(ellipse, nullptr);
+
+    const auto result{get_min_distance(*helix, *ellipse)};
+    const double sampled{get_sampled_distance(
+        *helix, ParameterRange{98.0 * math::two_pi, 102.0 * math::two_pi}, *ellipse, {0.0, math::two_pi}, 2000)};
+    EXPECT_LE(result.distance, sampled + math::precision);
+    EXPECT_GE(result.distance, sampled - 1e-3);
+    EXPECT_NEAR(get_distance(*helix, *ellipse, result), result.distance, 1e-12);
+}
+
+} // namespace intersection3d
+} // namespace curves
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace model3d {
+
+TEST(CurveFactory_test, try_create_reports_error) {
+    const Point3d center{0.0, 0.0, 0.0};
+    const Vector3d normal{0.0, 0.0, 1.0};
+
+    { // Valid circle
+        const auto& result{CurveFactory::try_create_circle(center, 1.0, normal)};
+        ASSERT_TRUE(result.has_value());
+        EXPECT_NE(*result, nullptr);
+        EXPECT_EQ(result.error(), Creation_error::none);
+    }
+
+    { // Invalid radius
+        const auto& result{CurveFactory::try_create_circle(center, -2.0, normal)};
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), Creation_error::invalid_radius);
+        EXPECT_EQ(result.failure().values[0], -2.0);
+    }
+
+    { // Degenerate normal
+        const auto& result{CurveFactory::try_create_ellipse(center, 2.0, 1.0, Vector3d{0.0, 0.0, 0.0})};
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), Creation_error::degenerate_normal);
+    }
+
+    { // Non-perpendicular frame
+        const auto& result{CurveFactory::try_create_helix(center, 1.0, 1.0, normal, Vector3d{0.0, 1.0, 1.0})};
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), Creation_error::non_perpendicular_frame);
+        EXPECT_NEAR(result.failure().values[0], std::sqrt(0.5), math::sqr_precision);
+    }
+}
+
+TEST(CurveFactory_test, try_create_random_curve_by_type) {
+    for (const auto type :
+        {CurveFactory::Curve_type::circle, CurveFactory::Curve_type::ellipse, CurveFactory::Curve_type::helix}) {
+        const auto& result{CurveFactory::try_create_random_curve_by_type(type)};
+        ASSERT_TRUE(result.has_value());
+        EXPECT_NE(*result, nullptr);
+    }
+    EXPECT_TRUE(std::dynamic_pointer_cast<Helix>(*CurveFactory::try_create_random_curve_by_type(
+        CurveFactory::Curve_type::helix)));
+
+    const auto& result{CurveFactory::try_create_random_curve_by_type(CurveFactory::Curve_type::size)};
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Creation_error::invalid_curve_type);
+    EXPECT_EQ(result.failure().values[0], static_cast<double>(CurveFactory::Curve_type::size));
+    EXPECT_FALSE(CurveFactory::create_random_curve_by_type(CurveFactory::Curve_type::size));
+}
+
+TEST(CurveFactory_test, creation_stats) {
+    const Point3d center{0.0, 0.0, 0.0};
+    const Vector3d normal{1.0, 0.0, 0.0};
+
+    CreationStats stats{};
+    stats.record(CurveFactory::try_create_circle(center, 1.0, normal));
+    stats.record(CurveFactory::try_create_circle(center, 0.0, normal));
+    stats.record(CurveFactory::try_create_helix(center, 1.0, 0.0));
+
+    CreationStats other{};
+    other.record(CurveFactory::try_create_circle(center, 0.0, normal));
+    stats += other;
+
+    EXPECT_EQ(stats.get_total_count(), 4);
+    EXPECT_EQ(stats.get_failure_count(), 3);
+    EXPECT_EQ(stats.get_count(Creation_error::invalid_radius), 2);
+    EXPECT_EQ(stats.get_count(Creation_error::invalid_helix_parameters), 1);
+}
+
+TEST(CurveFactory_test, create_circles_matches_single_creation) {
+    const std::vector<double> center_x{1.0, 2.0, 3.0, 4.0};
+    const std::vector<double> center_y{0.0, -1.0, 5.0, 7.0};
+    const std::vector<double> center_z{2.0, 2.0, 2.0, 2.0};
+    const std::vector<double> radii{1.5, 2.0, -1.0, 4.0};
+    const std::vector<double> normal_x{0.0, 3.0, 1.0, 0.0};
+    const std::vector<double> normal_y{0.0, -2.0, 1.0, 0.5};
+    const std::vector<double> normal_z{1.0, 7.0, 1.0, 0.0};
+
+    const CircleBatchInput input{{center_x, center_y, center_z}, radii, {normal_x, normal_y, normal_z}};
+    CurveBatch<Circle> batch{};
+    CurveFactory::create_circles(input, batch);
+
+    ASSERT_EQ(batch.status.size(), 4);
+    EXPECT_EQ(batch.status[2], Creation_error::invalid_radius);
+    EXPECT_EQ(batch.stats.get_failure_count(), 1);
+    ASSERT_EQ(batch.curves.size(), 3);
+
+    std::size_t created_index{};
+    for (std::size_t i{}; i < radii.size(); ++i) {
+        const auto& single{CurveFactory::try_create_circle(Point3d{center_x[i], center_y[i], center_z[i]},
+            radii[i],
+            Vector3d{normal_x[i], normal_y[i], normal_z[i]})};
+        EXPECT_EQ(single.error(), batch.status[i]);
+        if (!single) {
+            continue;
+        }
+
+        const auto& circle{batch.curves[created_index++]};
+        EXPECT_TRUE(math::equal((*single)->get_axis(), circle.get_axis(), 0.0));
+        EXPECT_TRUE(math::equal((*single)->get_axis_x(), circle.get_axis_x(), 0.0));
+        EXPECT_TRUE(math::equal((*single)->get_point(1.0), circle.get_point(1.0), 0.0));
+    }
+}
+
+TEST(CurveFactory_test, create_helices_reports_status) {
+    const std::vector<double> zeros{0.0, 0.0, 0.0};
+    const std::vector<double> radii{1.0, 1.0, 1.0};
+    const std::vector<double> steps{1.0, 0.0, 1.0};
+    const std::vector<double> axis_z{1.0, 1.0, 0.0};
+
+    const HelixBatchInput input{{zeros, zeros, zeros}, radii, steps, {zeros, zeros, axis_z}};
+    CurveBatch<Helix> batch{};
+    CurveFactory::create_helices(input, batch);
+
+    ASSERT_EQ(batch.status.size(), 3);
+    EXPECT_EQ(batch.status[0], Creation_error::none);
+    EXPECT_EQ(batch.status[1], Creation_error::invalid_helix_parameters);
+    EXPECT_EQ(batch.status[2], Creation_error::degenerate_normal);
+    EXPECT_EQ(batch.curves.size(), 1);
+    EXPECT_EQ(batch.stats.get_total_count(), 3);
+}
+
+TEST(CurveFactory_test, create_batch_rejects_mismatched_sizes) {
+    const std::vector<double> zeros{0.0, 0.0, 0.0};
+    const std::vector<double> ones{1.0, 1.0, 1.0};
+    const std::vector<double> short_ones{1.0, 1.0};
+
+    // One normal short: the batch is not truncated to two items, all three fail
+    CurveBatch<Circle> circles{};
+    CurveFactory::create_circles(CircleBatchInput{{zeros, zeros, zeros}, ones, {zeros, zeros, short_ones}}, circles);
+    EXPECT_TRUE(circles.curves.empty());
+    EXPECT_EQ(circles.status, std::vector<Creation_error>(3, Creation_error::mismatched_batch_sizes));
+    EXPECT_EQ(circles.stats.get_count(Creation_error::mismatched_batch_sizes), 3);
+
+    CurveBatch<Ellipse> ellipses{};
+    CurveFactory::create_ellipses(
+        EllipseBatchInput{{zeros, zeros, zeros}, ones, short_ones, {zeros, zeros, ones}}, ellipses);
+    EXPECT_TRUE(ellipses.curves.empty());
+    EXPECT_EQ(ellipses.stats.get_failure_count(), 3);
+
+    // A longer array is rejected as well
+    const std::vector<double> long_ones{1.0, 1.0, 1.0, 1.0};
+    CurveBatch<Helix> helices{};
+    CurveFactory::create_helices(
+        HelixBatchInput{{zeros, zeros, zeros}, ones, long_ones, {zeros, zeros, ones}}, helices);
+    EXPECT_TRUE(helices.curves.empty());
+    EXPECT_EQ(helices.status.size(), 4);
+    EXPECT_EQ(helices.stats.get_count(Creation_error::mismatched_batch_sizes), 4);
+
+    // Consistent again: the output is refilled
+    CurveFactory::create_circles(CircleBatchInput{{zeros, zeros, zeros}, ones, {zeros, zeros, ones}}, circles);
+    EXPECT_EQ(circles.curves.size(), 3);
+    EXPECT_EQ(circles.stats.get_failure_count(), 0);
+}
+
+} // namespace model3d
+} // namespace curves
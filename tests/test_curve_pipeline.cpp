@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/parallel/BoundedQueue.h"
+#include "curves/parallel/CurvePipeline.h"
+
+namespace curves {
+namespace parallel {
+
+namespace {
+
+Generator<Curve_chunk> get_chunks(std::span<const std::shared_ptr<model3d::Curve>> curves, std::size_t chunk_size) {
+    for (std::size_t begin{}; begin < curves.size(); begin += chunk_size) {
+        co_yield Curve_chunk(curves.begin() + begin, curves.begin() + std::min(begin + chunk_size, curves.size()));
+    }
+}
+
+// Counts the chunks taken from the generator
+Generator<Curve_chunk> get_counted_chunks(
+    std::span<const std::shared_ptr<model3d::Curve>> curves, std::size_t chunk_size, std::atomic<std::size_t>& count) {
+    for (std::size_t begin{}; begin < curves.size(); begin += chunk_size) {
+        ++count;
+        co_yield Curve_chunk(curves.begin() + begin, curves.begin() + std::min(begin + chunk_size, curves.size()));
+    }
+}
+
+Generator<int> count_to(int last) {
+    for (int i{1}; i <= last; ++i) {
+        co_yield i;
+    }
+}
+
+bool is_circle(const model3d::Curve& curve) {
+    return dynamic_cast<const model3d::Circle*>(&curve) != nullptr;
+}
+
+double get_radius(const model3d::Curve& curve) {
+    return static_cast<const model3d::Circle&>(curve).get_radius();
+}
+
+} // namespace
+
+class CurvePipeline_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i{}; i < 5000; ++i) {
+            curves.push_back(i % 97 == 0 ? nullptr : model3d::CurveFactory::create_random_curve());
+        }
+    }
+
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+};
+
+TEST_F(CurvePipeline_test, generator) {
+    auto generator{count_to(3)};
+    EXPECT_EQ(generator.next(), 1);
+    EXPECT_EQ(generator.next(), 2);
+    EXPECT_EQ(generator.next(), 3);
+    EXPECT_FALSE(generator.next());
+    EXPECT_FALSE(generator.next());
+}
+
+TEST_F(CurvePipeline_test, bounded_queue) {
+    BoundedQueue<int> queue{2};
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    queue.close();
+    EXPECT_FALSE(queue.push(3));
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_FALSE(queue.pop());
+}
+
+TEST_F(CurvePipeline_test, run_pipeline) {
+    PipelineOptions options;
+    options.keep_smallest = 50;
+    options.filter_threads = 3;
+    const auto result{run_pipeline(get_chunks(curves, 128), is_circle, get_radius, options)};
+
+    // Sequential reference
+    std::vector<double> radii;
+    std::size_t valid_count{};
+    for (const auto& curve : curves) {
+        if (curve) {
+            ++valid_count;
+            if (is_circle(*curve)) {
+                radii.push_back(get_radius(*curve));
+            }
+        }
+    }
+    std::sort(radii.begin(), radii.end());
+
+    EXPECT_EQ(result.generated_count, curves.size());
+    EXPECT_EQ(result.valid_count, valid_count);
+    EXPECT_EQ(result.selected_count, radii.size());
+    EXPECT_NEAR(result.key_sum, std::accumulate(radii.begin(), radii.end(), 0.0), 1e-9 * result.key_sum);
+    ASSERT_EQ(result.smallest.size(), 50);
+    for (std::size_t i{}; i < result.smallest.size(); ++i) {
+        EXPECT_EQ(result.smallest[i].key, radii[i]);
+        EXPECT_EQ(get_radius(*result.smallest[i].curve), radii[i]);
+    }
+    EXPECT_FALSE(result.cancelled);
+
+    // Independent of the thread count
+    options.filter_threads = 1;
+    const auto serial{run_pipeline(get_chunks(curves, 128), is_circle, get_radius, options)};
+    EXPECT_EQ(serial.key_sum, result.key_sum);
+    for (std::size_t i{}; i < result.smallest.size(); ++i) {
+        EXPECT_EQ(serial.smallest[i].curve, result.smallest[i].curve);
+    }
+}
+
+TEST_F(CurvePipeline_test, reorder_window) {
+    PipelineOptions options;
+    options.queue_capacity = 2;
+    options.filter_threads = 3;
+    const std::size_t max_alive{2 * options.queue_capacity + options.filter_threads + 2};
+
+    // The first chunk is slow, the later ones pile up behind it until the reorder window stops the filters
+    std::atomic<std::size_t> generated{};
+    std::size_t generated_while_slow{};
+    const auto slow_first{[&](const model3d::Curve& curve) {
+        if (&curve == curves[1].get()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{100});
+            generated_while_slow = generated;
+        }
+        return is_circle(curve);
+    }};
+
+    const auto result{run_pipeline(get_counted_chunks(curves, 100, generated), slow_first, get_radius, options)};
+    EXPECT_EQ(result.generated_count, curves.size());
+    EXPECT_EQ(generated, 50);
+    EXPECT_LE(generated_while_slow, max_alive);
+}
+
+TEST_F(CurvePipeline_test, generate_random_curves) {
+    const auto select_all{[](const model3d::Curve&) { return true; }};
+    const auto count{[](const model3d::Curve&) { return 1.0; }};
+    const auto result{run_pipeline(generate_random_curves(1000, 64), select_all, count)};
+    EXPECT_EQ(result.generated_count, 1000);
+    EXPECT_EQ(result.key_sum, static_cast<double>(result.valid_count));
+}
+
+TEST_F(CurvePipeline_test, errors) {
+    const auto throwing_key{[](const model3d::Curve&) -> double { throw std::runtime_error{"key"}; }};
+    EXPECT_THROW(run_pipeline(get_chunks(curves, 128), is_circle, throwing_key), std::runtime_error);
+
+    JobControl control;
+    control.cancel();
+    const auto result{run_pipeline(get_chunks(curves, 128), is_circle, get_radius, {}, &control)};
+    EXPECT_TRUE(result.cancelled);
+    EXPECT_EQ(result.generated_count, 0);
+}
+
+} // namespace parallel
+} // namespace curves
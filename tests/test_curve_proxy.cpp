@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/CurveProxy.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace model3d {
+
+class CurveProxy_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        curves.push_back(CurveFactory::create_circle(Point3d{10.0, -20.0, 5.0}, 3.0, Vector3d{1.0, 2.0, 2.0}));
+        curves.push_back(CurveFactory::create_ellipse(Point3d{-1.0, 0.5, 2.0}, 5.0, 0.5, Vector3d{0.0, 1.0, 0.0}));
+        curves.push_back(CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 2.0, 0.7, Vector3d{1.0, 1.0, 0.0}));
+        curves.push_back(CurveFactory::create_circle(Point3d{1e5, 1e5, -1e5}, 1e6, Vector3d{0.0, 0.0, 1.0}));
+        for (const auto& curve : curves) {
+            ASSERT_NE(curve, nullptr);
+        }
+    }
+
+    static double get_size(const Curve& curve) {
+        if (const auto* ellipse{dynamic_cast<const Ellipse*>(&curve)}) {
+            return ellipse->get_radius_major();
+        }
+        if (const auto* helix{dynamic_cast<const Helix*>(&curve)}) {
+            return helix->get_radius();
+        }
+        return dynamic_cast<const Circle&>(curve).get_radius();
+    }
+
+    std::vector<std::shared_ptr<Curve>> curves;
+};
+
+TEST_F(CurveProxy_test, tiers_meet_tolerance) {
+    for (const auto& curve : curves) {
+        std::size_t previous_interval_count{};
+        for (const auto tier :
+            {Approximation_tier::preview, Approximation_tier::standard, Approximation_tier::precise}) {
+            const auto proxy{CurveProxy::build(*curve, tier)};
+            ASSERT_TRUE(proxy.has_value());
+            EXPECT_GE(proxy->get_interval_count(), previous_interval_count);
+            previous_interval_count = proxy->get_interval_count();
+
+            const double tolerance{get_size(*curve) * get_relative_tolerance(tier)};
+            EXPECT_LE(proxy->get_point_error(), tolerance);
+            EXPECT_LE(proxy->get_derivative_error(), tolerance);
+
+            // Parameters outside the fitted turn, including far turns of the helix
+            for (const double t : {-7.3, 0.0, 1.234, 6.28, 100.5, 1e4 + 0.1}) {
+                const double point_error{std::sqrt(math::get_sqr_distance(proxy->get_point(t), curve->get_point(t)))};
+                EXPECT_LE(point_error, 4.0 * tolerance + 1e-12 * std::abs(t)) << t;
+                EXPECT_LE((proxy->get_first_derivative(t) - curve->get_first_derivative(t)).get_magnitude(),
+                    4.0 * tolerance)
+                    << t;
+            }
+        }
+    }
+}
+
+TEST_F(CurveProxy_test, far_from_origin) {
+    // The coordinates are a million times the radius, the tolerance is relative to the radius
+    const auto circle{CurveFactory::create_circle(Point3d{999999.0, 0.0, 0.0}, 1.0, Vector3d{0.0, 0.0, 1.0})};
+    const auto proxy{CurveProxy::build(*circle, Approximation_tier::precise)};
+    ASSERT_TRUE(proxy.has_value());
+    EXPECT_LE(proxy->get_point_error(), get_relative_tolerance(Approximation_tier::precise));
+    EXPECT_LE(proxy->get_derivative_error(), get_relative_tolerance(Approximation_tier::precise));
+
+    // The points are off by the tolerance and the rounding of coordinates near 1e6 (ulp 1.2e-10)
+    for (const double t : {0.0, 0.7, 2.5, 4.0, 6.0}) {
+        EXPECT_LE(std::sqrt(math::get_sqr_distance(proxy->get_point(t), circle->get_point(t))), 3e-10) << t;
+    }
+}
+
+TEST_F(CurveProxy_test, unreachable_tolerance) {
+    EXPECT_FALSE(CurveProxy::build(*curves[0], 1e-20).has_value());
+    EXPECT_FALSE(CurveProxy::build(*curves[0], 0.0).has_value());
+}
+
+TEST_F(CurveProxy_test, sample_uniform) {
+    const auto proxy{CurveProxy::build(*curves[2], 1e-9)};
+    ASSERT_TRUE(proxy.has_value());
+
+    std::vector<Point3d> samples(50);
+    proxy->sample_uniform(-3.0, 0.37, samples);
+    for (std::size_t i{}; i < samples.size(); ++i) {
+        EXPECT_TRUE(math::equal(samples[i], curves[2]->get_point(-3.0 + static_cast<double>(i) * 0.37), 1e-8));
+    }
+}
+
+} // namespace model3d
+} // namespace curves
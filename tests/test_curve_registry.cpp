@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/CurveRegistry.h"
+
+namespace curves {
+namespace parallel {
+
+class CurveRegistry_test : public ::testing::Test {
+protected:
+    static std::shared_ptr<model3d::Curve> create_circle(double radius) {
+        return model3d::CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, radius, Vector3d{0.0, 0.0, 1.0});
+    }
+
+    using Point3d = model3d::Point3d;
+    using Vector3d = model3d::Vector3d;
+};
+
+TEST_F(CurveRegistry_test, insert_remove) {
+    CurveRegistry registry;
+    const auto circle{create_circle(1.0)};
+    const auto handle{registry.insert(circle)};
+    ASSERT_TRUE(handle.is_valid());
+    EXPECT_EQ(registry.size(), 1);
+    EXPECT_FALSE(registry.insert(nullptr).is_valid());
+
+    {
+        const CurveRegistry::Guard guard{registry};
+        EXPECT_EQ(registry.get(handle, guard), circle.get());
+    }
+    EXPECT_EQ(registry.get_shared(handle), circle);
+
+    EXPECT_TRUE(registry.remove(handle));
+    EXPECT_FALSE(registry.remove(handle));
+    EXPECT_EQ(registry.size(), 0);
+    EXPECT_FALSE(registry.get_shared(handle));
+
+    // The slot is reused with a new generation, the old handle stays stale
+    const auto reused{registry.insert(create_circle(2.0))};
+    EXPECT_EQ(reused.get_index(), handle.get_index());
+    EXPECT_NE(reused, handle);
+    EXPECT_FALSE(registry.get_shared(handle));
+    EXPECT_TRUE(registry.get_shared(reused));
+}
+
+TEST_F(CurveRegistry_test, reclamation) {
+    CurveRegistry registry;
+    std::weak_ptr<model3d::Curve> observer;
+    CurveHandle handle;
+    {
+        auto circle{create_circle(1.0)};
+        observer = circle;
+        handle = registry.insert(std::move(circle));
+    }
+
+    {
+        const CurveRegistry::Guard guard{registry};
+        const auto curve{registry.get(handle, guard)};
+        ASSERT_TRUE(curve);
+        registry.remove(handle);
+
+        // Still referenced by the guard
+        registry.collect();
+        registry.collect();
+        EXPECT_FALSE(observer.expired());
+        EXPECT_EQ(static_cast<const model3d::Circle*>(curve)->get_radius(), 1.0);
+    }
+
+    registry.collect();
+    registry.collect();
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST_F(CurveRegistry_test, for_each) {
+    CurveRegistry registry;
+    registry.insert(create_circle(1.0));
+    registry.insert(model3d::CurveFactory::create_random_helix());
+    registry.insert(create_circle(2.0));
+
+    const CurveRegistry::Guard guard{registry};
+    double radius_sum{};
+    registry.for_each(model3d::CurveFactory::Curve_type::circle, guard, [&](CurveHandle, const model3d::Curve& curve) {
+        radius_sum += static_cast<const model3d::Circle&>(curve).get_radius();
+    });
+    EXPECT_EQ(radius_sum, 3.0);
+}
+
+TEST_F(CurveRegistry_test, concurrent) {
+    CurveRegistry registry;
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> visited{};
+
+    std::vector<std::thread> readers;
+    for (std::size_t i{}; i < 2; ++i) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                const CurveRegistry::Guard guard{registry};
+                registry.for_each(
+                    model3d::CurveFactory::Curve_type::circle, guard, [&](CurveHandle, const model3d::Curve& curve) {
+                        EXPECT_GT(static_cast<const model3d::Circle&>(curve).get_radius(), 0.0);
+                        visited.fetch_add(1, std::memory_order_relaxed);
+                    });
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (std::size_t i{}; i < 4; ++i) {
+        writers.emplace_back([&, i]() {
+            std::vector<CurveHandle> handles;
+            for (std::size_t round{}; round < 2000; ++round) {
+                handles.push_back(registry.insert(create_circle(1.0 + static_cast<double>(i))));
+                if (round % 3 == 2) {
+                    EXPECT_TRUE(registry.remove(handles[handles.size() - 2]));
+                    handles.erase(handles.end() - 2);
+                }
+            }
+            for (const auto handle : handles) {
+                const CurveRegistry::Guard guard{registry};
+                const auto curve{registry.get(handle, guard)};
+                ASSERT_TRUE(curve);
+                EXPECT_EQ(static_cast<const model3d::Circle*>(curve)->get_radius(), 1.0 + static_cast<double>(i));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(registry.size(), 4 * (2000 - 2000 / 3));
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "curves/index/Deduplication.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace index {
+
+namespace {
+
+using model3d::CurveFactory;
+using Point3d = math::Point<double, 3>;
+using Vector3d = math::Vector<double, 3>;
+
+// Sequential scan the deduplication has to reproduce: remap of every curve to its first equivalent kept curve
+std::vector<std::uint32_t> get_sequential_remap(std::span<const std::shared_ptr<model3d::Curve>> curves) {
+    std::vector<std::uint32_t> kept;
+    std::vector<std::uint32_t> remap;
+    for (std::size_t i{}; i < curves.size(); ++i) {
+        const auto found{std::find_if(kept.begin(), kept.end(), [&](std::uint32_t index) {
+            return are_equivalent(*curves[index], *curves[i]);
+        })};
+        remap.push_back(static_cast<std::uint32_t>(found - kept.begin()));
+        if (found == kept.end()) {
+            kept.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    return remap;
+}
+
+} // namespace
+
+TEST(Deduplication_test, equivalence) {
+    const Point3d center{1.0, 2.0, 3.0};
+    const Vector3d normal{0.0, 0.0, 1.0};
+    const Vector3d flipped{0.0, 0.0, -1.0};
+
+    // Phase and axis sign do not matter
+    const auto circle{CurveFactory::create_circle(center, 2.0, normal)};
+    EXPECT_TRUE(are_equivalent(*circle, *CurveFactory::create_circle(center, 2.0, flipped, Vector3d{0.0, 1.0, 0.0})));
+    EXPECT_TRUE(are_equivalent(*circle, *CurveFactory::create_circle(Point3d{1.0, 2.0, 3.000001}, 2.000001, normal)));
+    EXPECT_FALSE(are_equivalent(*circle, *CurveFactory::create_circle(center, 2.001, normal)));
+    EXPECT_FALSE(are_equivalent(*circle, *CurveFactory::create_circle(center, 2.0, Vector3d{0.0, 1.0, 0.0})));
+
+    // The major direction matters up to the sign
+    const auto ellipse{CurveFactory::create_ellipse(center, 3.0, 1.0, normal, Vector3d{1.0, 0.0, 0.0})};
+    EXPECT_TRUE(
+        are_equivalent(*ellipse, *CurveFactory::create_ellipse(center, 3.0, 1.0, flipped, Vector3d{-1.0, 0.0, 0.0})));
+    EXPECT_TRUE(
+        are_equivalent(*ellipse, *CurveFactory::create_ellipse(center, 1.0, 3.0, normal, Vector3d{0.0, 1.0, 0.0})));
+    EXPECT_FALSE(
+        are_equivalent(*ellipse, *CurveFactory::create_ellipse(center, 3.0, 1.0, normal, Vector3d{0.0, 1.0, 0.0})));
+    EXPECT_FALSE(are_equivalent(*ellipse, *circle));
+
+    // Same point set: shifted by a whole step, reversed axis, or started elsewhere on the same helix
+    const auto helix{CurveFactory::create_helix(center, 2.0, 0.5, normal, Vector3d{1.0, 0.0, 0.0})};
+    EXPECT_TRUE(are_equivalent(
+        *helix, *CurveFactory::create_helix(Point3d{1.0, 2.0, 4.0}, 2.0, 0.5, normal, Vector3d{1.0, 0.0, 0.0})));
+    EXPECT_TRUE(are_equivalent(
+        *helix, *CurveFactory::create_helix(Point3d{1.0, 2.0, 13.0}, 2.0, 0.5, flipped, Vector3d{1.0, 0.0, 0.0})));
+    const auto shifted{math::translate(center, normal * (0.5 / math::two_pi))};
+    EXPECT_TRUE(are_equivalent(
+        *helix, *CurveFactory::create_helix(shifted, 2.0, 0.5, normal, helix->get_point(1.0) - shifted)));
+    EXPECT_FALSE(are_equivalent(
+        *helix, *CurveFactory::create_helix(Point3d{1.0, 2.0, 3.25}, 2.0, 0.5, normal, Vector3d{1.0, 0.0, 0.0})));
+    EXPECT_FALSE(
+        are_equivalent(*helix, *CurveFactory::create_helix(center, 2.0, 0.6, normal, Vector3d{1.0, 0.0, 0.0})));
+}
+
+TEST(Deduplication_test, deduplicate) {
+    const Vector3d normal{0.0, 0.0, 1.0};
+    std::vector<std::shared_ptr<model3d::Curve>> curves{
+        CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, normal),
+        CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 1.0, 2.0, normal, Vector3d{1.0, 0.0, 0.0}),
+        CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, Vector3d{0.0, 0.0, -1.0}),
+        CurveFactory::create_circle(Point3d{5.0, 0.0, 0.0}, 1.0, normal),
+        CurveFactory::create_helix(Point3d{0.0, 0.0, -4.0}, 1.0, 2.0, normal, Vector3d{1.0, 0.0, 0.0}),
+        CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0 - 0.9 * math::precision, normal),
+        // Radius keys straddling the cell border at 1 + 2 * precision
+        CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0 + 1.5 * math::precision, normal),
+        CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0 + 2.4 * math::precision, normal),
+    };
+
+    const auto result{deduplicate(curves)};
+    ASSERT_EQ(result.curves.size(), 4);
+    EXPECT_EQ(result.source, (std::vector<std::uint32_t>{0, 1, 3, 6}));
+    EXPECT_EQ(result.remap, (std::vector<std::uint32_t>{0, 1, 0, 2, 1, 0, 3, 3}));
+    for (std::size_t i{}; i < result.curves.size(); ++i) {
+        EXPECT_EQ(result.curves[i], curves[result.source[i]]);
+    }
+}
+
+TEST(Deduplication_test, distinct_axes) {
+    // Concentric circles of the same radius, a bearing or fastener set: the axis keeps them in separate cells
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+    for (std::size_t i{}; i < 20000; ++i) {
+        const double angle{math::pi * static_cast<double>(i) / 20000.0};
+        curves.push_back(CurveFactory::create_circle(
+            Point3d{0.0, 0.0, 0.0}, 1.0, Vector3d{std::cos(angle), std::sin(angle), 0.1 * std::cos(3.0 * angle)}));
+    }
+    // Every one again with the axis reversed
+    for (std::size_t i{}; i < 20000; i += 7) {
+        const auto& circle{static_cast<const model3d::Circle&>(*curves[i])};
+        curves.push_back(CurveFactory::create_circle(circle.get_center(), 1.0, circle.get_axis() * -1.0));
+    }
+
+    const auto result{deduplicate(curves)};
+    EXPECT_EQ(result.curves.size(), 20000);
+    for (std::size_t i{20000}; i < curves.size(); ++i) {
+        EXPECT_EQ(result.remap[i], (i - 20000) * 7);
+    }
+}
+
+TEST(Deduplication_test, far_from_origin) {
+    // Helices with axes tilted within the precision, far from the origin: their axis feet are far apart
+    const Point3d center{3e5, -2e5, 1e5};
+    const Vector3d axis{0.3, 0.4, 1.0};
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+    for (std::size_t i{}; i < 200; ++i) {
+        const double tilt{0.9 * math::precision * std::sin(static_cast<double>(i))};
+        const Vector3d tilted{0.3 + tilt, 0.4 - tilt, 1.0};
+        const auto shifted{math::translate(center, axis * (0.5 * static_cast<double>(i % 3) / axis.get_magnitude()))};
+        curves.push_back(CurveFactory::create_helix(shifted, 2.0, 0.5, i % 2 ? tilted : tilted * -1.0));
+    }
+
+    const auto remap{get_sequential_remap(curves)};
+    const auto result{deduplicate(curves)};
+    EXPECT_EQ(result.remap, remap);
+    EXPECT_LT(result.curves.size(), curves.size() / 2);
+}
+
+TEST(Deduplication_test, parallel) {
+    // Random curves with every curve repeated under another parameterization
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+    for (std::size_t i{}; i < 10000; ++i) {
+        curves.push_back(CurveFactory::create_random_curve());
+    }
+    for (std::size_t i{}; i < 10000; i += 3) {
+        const auto* helix{dynamic_cast<const model3d::Helix*>(curves[i].get())};
+        if (const auto* circle{dynamic_cast<const model3d::Circle*>(curves[i].get())}) {
+            curves.push_back(
+                CurveFactory::create_circle(circle->get_center(), circle->get_radius(), circle->get_axis() * -1.0));
+        } else if (helix) {
+            const auto center{math::translate(helix->get_center(), helix->get_axis() * helix->get_step())};
+            curves.push_back(CurveFactory::create_helix(
+                center, helix->get_radius(), helix->get_step(), helix->get_axis(), helix->get_axis_x()));
+        } else {
+            curves.push_back(curves[i]);
+        }
+    }
+
+    const auto serial{deduplicate(curves)};
+    parallel::Executor executor{4};
+    const auto result{deduplicate(curves, math::precision, &executor)};
+    EXPECT_EQ(result.source, serial.source);
+    EXPECT_EQ(result.remap, serial.remap);
+    EXPECT_LE(result.curves.size(), 10000);
+
+    // Every curve maps to an equivalent kept curve that does not come later
+    ASSERT_EQ(result.remap.size(), curves.size());
+    for (std::size_t i{}; i < curves.size(); ++i) {
+        ASSERT_LT(result.remap[i], result.curves.size());
+        EXPECT_LE(result.source[result.remap[i]], i);
+        EXPECT_TRUE(are_equivalent(*result.curves[result.remap[i]], *curves[i]));
+    }
+}
+
+} // namespace index
+} // namespace curves
@@ -78,5 +78,41 @@ TEST_F(Ellipse_test, get_first_derivative) {
     }
 }
 
+TEST_F(Ellipse_test, sample_uniform) {
+    EXPECT_NE(ellipse, nullptr);
+
+    const double t0{-3.0};
+    const double dt{0.01};
+    std::vector<Point3d> points(1000);
+    ellipse->sample_uniform(t0, dt, points);
+
+    for (std::size_t i{}; i < points.size(); ++i) {
+        const auto& calibration_point{ellipse->get_point(t0 + static_cast<double>(i) * dt)};
+        EXPECT_TRUE(math::equal(points[i], calibration_point, math::sqr_precision));
+    }
+}
+
+TEST_F(Ellipse_test, evaluate) {
+    const std::array<double, 4> parameters{-2.5, 0.0, 1.0, 40.0};
+    std::array<CurveEvaluation, 4> batch;
+    ellipse->evaluate(parameters, 2, batch);
+
+    for (std::size_t i{}; i < parameters.size(); ++i) {
+        const double t{parameters[i]};
+        const auto evaluation{ellipse->evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.point, ellipse->get_point(t), 0.0));
+        EXPECT_TRUE(math::equal(evaluation.first_derivative, ellipse->get_first_derivative(t), 0.0));
+        EXPECT_TRUE(math::equal(batch[i].point, evaluation.point, 0.0));
+        EXPECT_TRUE(math::equal(batch[i].second_derivative, evaluation.second_derivative, 0.0));
+
+        // Generic numeric second derivative
+        const auto numeric{ellipse->Curve::evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.second_derivative, numeric.second_derivative, 1e-6));
+    }
+
+    const auto point_only{ellipse->evaluate(1.0, 0)};
+    EXPECT_TRUE(math::equal(point_only.first_derivative, Vector3d{0.0, 0.0, 0.0}, 0.0));
+}
+
 } // namespace model3d
 } // namespace curves
\ No newline at end of file
@@ -84,5 +84,87 @@ TEST_F(Helix_test, get_first_derivative) {
     }
 }
 
+TEST_F(Helix_test, sample_uniform) {
+    EXPECT_NE(helix, nullptr);
+
+    const double t0{-3.0};
+    const double dt{0.01};
+    std::vector<Point3d> points(1000);
+    helix->sample_uniform(t0, dt, points);
+
+    for (std::size_t i{}; i < points.size(); ++i) {
+        const auto& calibration_point{helix->get_point(t0 + static_cast<double>(i) * dt)};
+        EXPECT_TRUE(math::equal(points[i], calibration_point, math::sqr_precision));
+    }
+}
+
+TEST_F(Helix_test, split_parameter) {
+    {
+        const auto& parameter{Helix::split_parameter(-math::half_pi)};
+        EXPECT_EQ(parameter.turn, -1);
+        EXPECT_NEAR(parameter.angle, math::three_pi_over_two, math::sqr_precision);
+    }
+
+    {
+        const auto& parameter{Helix::split_parameter(math::two_pi * 1000000.0 + 1.0)};
+        EXPECT_EQ(parameter.turn, 1000000);
+        EXPECT_NEAR(parameter.angle, 1.0, 1e-8);
+    }
+
+    { // Largest parameters within the turn counter
+        const std::int64_t turn{std::int64_t{1} << 62};
+        const auto& parameter{Helix::split_parameter(-math::two_pi * static_cast<double>(turn))};
+        EXPECT_EQ(parameter.turn, -turn);
+        EXPECT_FALSE(std::isnan(parameter.angle));
+    }
+
+    // Not finite or out of the range of the turn counter
+    const double infinity{std::numeric_limits<double>::infinity()};
+    for (const double t : {std::numeric_limits<double>::quiet_NaN(), infinity, -infinity, 1e20, -1e20, 1e300}) {
+        const auto& parameter{Helix::split_parameter(t)};
+        EXPECT_EQ(parameter.turn, 0) << t;
+        EXPECT_TRUE(std::isnan(parameter.angle)) << t;
+        EXPECT_TRUE(std::isnan(helix->get_point(t).x())) << t;
+    }
+}
+
+TEST_F(Helix_test, get_point_by_turn) {
+    EXPECT_NE(helix, nullptr);
+
+    { // One million turns and 90.0 degrees
+        const Point3d calibration_point{5.0 + 2000000.5, 5.0, 15.0};
+        const auto& point{helix->get_point(HelixParameter{1000000, math::half_pi})};
+        EXPECT_TRUE(math::equal(point, calibration_point, math::sqr_precision));
+    }
+
+    { // Plain parameter, reduced internally
+        const double t{12345.678};
+        const Point3d calibration_point{5.0 + 2.0 * t / math::two_pi, 5.0 + 10.0 * std::cos(t), 5.0 + 10.0 * std::sin(t)};
+        EXPECT_TRUE(math::equal(helix->get_point(t), calibration_point, math::sqr_precision));
+    }
+}
+
+TEST_F(Helix_test, evaluate) {
+    const std::array<double, 4> parameters{-2.5, 0.0, 1.0, 40.0};
+    std::array<CurveEvaluation, 4> batch;
+    helix->evaluate(parameters, 2, batch);
+
+    for (std::size_t i{}; i < parameters.size(); ++i) {
+        const double t{parameters[i]};
+        const auto evaluation{helix->evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.point, helix->get_point(t), 0.0));
+        EXPECT_TRUE(math::equal(evaluation.first_derivative, helix->get_first_derivative(t), 0.0));
+        EXPECT_TRUE(math::equal(batch[i].point, evaluation.point, 0.0));
+        EXPECT_TRUE(math::equal(batch[i].second_derivative, evaluation.second_derivative, 0.0));
+
+        // Generic numeric second derivative
+        const auto numeric{helix->Curve::evaluate(t, 2)};
+        EXPECT_TRUE(math::equal(evaluation.second_derivative, numeric.second_derivative, 1e-6));
+    }
+
+    const auto point_only{helix->evaluate(1.0, 0)};
+    EXPECT_TRUE(math::equal(point_only.first_derivative, Vector3d{0.0, 0.0, 0.0}, 0.0));
+}
+
 } // namespace model3d
 } // namespace curves
\ No newline at end of file
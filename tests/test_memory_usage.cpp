@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "curves/index/RadiusBTree.h"
+#include "curves/index/RadiusIndex.h"
+#include "curves/intersection3d/CircleAxisIndex.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/CurveProxy.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/model3d/MemoryUsage.h"
+#include "curves/model3d/SharedCurveStore.h"
+#include "curves/parallel/CurveRegistry.h"
+#include "curves/parallel/PartitionedCurveStore.h"
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+namespace curves {
+namespace model3d {
+
+class MemoryUsage_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i{}; i < 10; ++i) {
+            curves.push_back(CurveFactory::create_random_curve_by_type(
+                static_cast<CurveFactory::Curve_type>(i % static_cast<std::size_t>(CurveFactory::Curve_type::size))));
+        }
+    }
+
+    std::vector<std::shared_ptr<Curve>> curves;
+};
+
+TEST_F(MemoryUsage_test, get_allocation_overhead) {
+    EXPECT_EQ(get_allocation_overhead(0), 0);
+    EXPECT_EQ(get_allocation_overhead(1), 31);
+    EXPECT_EQ(get_allocation_overhead(24), 8);
+    EXPECT_EQ(get_allocation_overhead(100), 12);
+}
+
+TEST_F(MemoryUsage_test, memory_usage) {
+    EXPECT_EQ(memory_usage(*curves[0]).payload, sizeof(Circle));
+    EXPECT_EQ(memory_usage(*curves[1]).payload, sizeof(Ellipse));
+
+    const auto scattered{memory_usage(curves)};
+    EXPECT_EQ(scattered.payload, 4 * sizeof(Circle) + 3 * sizeof(Ellipse) + 3 * sizeof(Helix));
+    EXPECT_EQ(scattered.index, curves.size() * sizeof(std::shared_ptr<Curve>));
+
+    // A shared curve is counted once
+    auto duplicated{curves};
+    duplicated.push_back(curves[0]);
+    EXPECT_EQ(memory_usage(duplicated).payload, scattered.payload);
+
+    const auto store{CurveStore::compact(curves)};
+    ASSERT_TRUE(store);
+    const auto compacted{memory_usage(*store)};
+    EXPECT_EQ(compacted.payload, scattered.payload);
+    EXPECT_LT(compacted.allocator_overhead, scattered.allocator_overhead);
+    EXPECT_LT(compacted.get_total(), scattered.get_total());
+}
+
+TEST_F(MemoryUsage_test, structures) {
+    std::vector<std::shared_ptr<Circle>> circles;
+    std::vector<double> radii;
+    for (std::size_t i{}; i < 1000; ++i) {
+        circles.push_back(CurveFactory::create_random_circle());
+        radii.push_back(circles.back()->get_radius());
+    }
+
+    const auto radius_index{memory_usage(index::RadiusIndex::build(radii))};
+    EXPECT_GE(radius_index.index, radii.size() * (sizeof(index::RadiusItem) + sizeof(double)));
+    EXPECT_EQ(radius_index.payload, 0);
+
+    const auto radius_tree{memory_usage(index::RadiusBTree::build(radii))};
+    EXPECT_GE(radius_tree.index, radii.size() * sizeof(index::RadiusItem));
+
+    const auto axis_index{memory_usage(intersection3d::CircleAxisIndex{circles})};
+    EXPECT_GE(axis_index.index, circles.size() * (sizeof(std::shared_ptr<Circle>) + sizeof(std::uint32_t)));
+
+    // The registry counts the curves once, like the pointer vector
+    parallel::CurveRegistry registry;
+    for (const auto& curve : curves) {
+        registry.insert(curve);
+    }
+    registry.insert(curves[0]);
+    const auto registered{memory_usage(registry)};
+    EXPECT_EQ(registered.payload, memory_usage(curves).payload);
+    EXPECT_GT(registered.index, curves.size() * sizeof(std::shared_ptr<Curve>));
+
+    parallel::Executor executor{2};
+    const auto partitioned{parallel::PartitionedCurveStore::build(curves, executor)};
+    ASSERT_TRUE(partitioned);
+    EXPECT_EQ(memory_usage(*partitioned).payload, memory_usage(*CurveStore::compact(curves)).payload);
+
+    const auto proxy{CurveProxy::build(*curves[0], Approximation_tier::standard)};
+    ASSERT_TRUE(proxy);
+    EXPECT_EQ(memory_usage(*proxy).payload,
+        2 * proxy->get_interval_count() * 3 * (CurveProxy::degree + 1) * sizeof(double));
+
+#ifdef __unix__
+    const std::string name{"/curves_memory_usage_test_" + std::to_string(getpid())};
+    const auto shared{SharedCurveStore::create(name, 100)};
+    ASSERT_TRUE(shared);
+    const auto mapped{memory_usage(*shared)};
+    EXPECT_EQ(mapped.payload, 2 * 100 * sizeof(SharedCurveRecord));
+    EXPECT_GT(mapped.index, 0);
+    EXPECT_EQ(mapped.get_total() % static_cast<std::size_t>(sysconf(_SC_PAGESIZE)), 0);
+    SharedCurveStore::remove(name);
+#endif
+}
+
+TEST_F(MemoryUsage_test, compact) {
+    const auto store{CurveStore::compact(curves)};
+    ASSERT_TRUE(store);
+    ASSERT_EQ(store->size(), curves.size());
+    EXPECT_EQ(store->get_circles().size(), 4);
+    EXPECT_EQ(store->get_ellipses().size(), 3);
+    EXPECT_EQ(store->get_helices().size(), 3);
+
+    for (std::size_t i{}; i < curves.size(); ++i) {
+        EXPECT_TRUE(math::equal((*store)[i].get_point(0.7), curves[i]->get_point(0.7), 0.0));
+        EXPECT_NE((*store)[i].get_id(), curves[i]->get_id());
+    }
+}
+
+TEST_F(MemoryUsage_test, allocation_tracker) {
+    AllocationTracker tracker;
+    CurveFactory::set_allocation_tracker(&tracker);
+    const std::size_t circle_bytes{get_shared_object_usage(sizeof(Circle)).get_total()};
+    {
+        auto first{CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, Vector3d{0.0, 0.0, 1.0})};
+        auto second{CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 2.0, Vector3d{0.0, 0.0, 1.0})};
+        EXPECT_EQ(tracker.get_live_count(), 2);
+        EXPECT_EQ(tracker.get_current_bytes(), 2 * circle_bytes);
+
+        // Failed creations allocate nothing
+        EXPECT_FALSE(CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, -1.0, Vector3d{0.0, 0.0, 1.0}));
+        EXPECT_EQ(tracker.get_allocation_count(), 2);
+    }
+    CurveFactory::set_allocation_tracker(nullptr);
+
+    EXPECT_EQ(tracker.get_live_count(), 0);
+    EXPECT_EQ(tracker.get_current_bytes(), 0);
+    EXPECT_EQ(tracker.get_peak_bytes(), 2 * circle_bytes);
+
+    tracker.reset_peak();
+    EXPECT_EQ(tracker.get_peak_bytes(), 0);
+}
+
+} // namespace model3d
+} // namespace curves
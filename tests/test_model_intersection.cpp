@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "curves/intersection3d/CircleAxisIndex.h"
+#include "curves/intersection3d/ModelIntersection.h"
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace intersection3d {
+
+using model3d::CurveFactory;
+using model3d::Vector3d;
+
+TEST(ModelIntersection_test, get_intersection_hits) {
+    const Vector3d axis{0.0, 0.0, 1.0};
+    const auto& helix{CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 2.0, 4.0, axis, Vector3d{1.0, 0.0, 0.0})};
+    const auto& circle{CurveFactory::create_circle(Point3d{0.0, 0.0, 1.0}, 2.0, axis, Vector3d{0.0, 1.0, 0.0})};
+    ASSERT_NE(helix, nullptr);
+    ASSERT_NE(circle, nullptr);
+
+    std::vector<IntersectionHit> hits{};
+    EXPECT_EQ(get_intersection_hits(*helix, *circle, hits), 1);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_NEAR(hits[0].t_a, math::half_pi, math::precision);
+    EXPECT_NEAR(hits[0].t_b, 0.0, math::precision);
+    EXPECT_TRUE(math::equal(hits[0].point, Point3d{0.0, 2.0, 1.0}, math::precision));
+    EXPECT_EQ(hits[0].kind, Intersection_kind::transversal);
+
+    // Hits are appended, parameters follow the order of the arguments
+    EXPECT_EQ(get_intersection_hits(*circle, *helix, hits), 1);
+    ASSERT_EQ(hits.size(), 2);
+    EXPECT_NEAR(hits[1].t_a, 0.0, math::precision);
+    EXPECT_NEAR(hits[1].t_b, math::half_pi, math::precision);
+
+    EXPECT_EQ(get_intersection(*helix, *circle).size(), 1);
+}
+
+TEST(ModelIntersection_test, circle_axis_index) {
+    const Vector3d axis{0.0, 0.0, 1.0};
+    const auto& helix{CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 2.0, 4.0, axis, Vector3d{1.0, 0.0, 0.0})};
+    ASSERT_NE(helix, nullptr);
+
+    std::vector<std::shared_ptr<model3d::Circle>> circles;
+    for (std::size_t i{}; i < 300; ++i) {
+        const double height{static_cast<double>(i) * 0.1};
+        switch (i % 4) {
+        case 0: // Coaxial, same radius: one hit
+            circles.push_back(CurveFactory::create_circle(Point3d{0.0, 0.0, height}, 2.0, axis));
+            break;
+        case 1: // Coaxial, other radius
+            circles.push_back(CurveFactory::create_circle(Point3d{0.0, 0.0, height}, 3.0, axis));
+            break;
+        case 2: { // Parallel axis, opposite orientation, passing through the helix
+            const auto point{helix->get_point(height * math::two_pi / 4.0)};
+            circles.push_back(
+                CurveFactory::create_circle(Point3d{point.x() + 1.0, point.y(), point.z()}, 1.0, axis * -1.0));
+            break;
+        }
+        default: // Tilted
+            circles.push_back(CurveFactory::create_circle(Point3d{0.0, 0.0, height}, 2.0, Vector3d{1.0, 0.0, 1.0}));
+            break;
+        }
+        ASSERT_NE(circles.back(), nullptr);
+    }
+
+    const CircleAxisIndex index{circles};
+    const auto hits{get_intersection(*helix, index)};
+
+    std::vector<CircleIntersection> expected;
+    for (std::size_t i{}; i < circles.size(); ++i) {
+        for (const auto& hit : get_intersection_hits(*helix, *circles[i])) {
+            expected.push_back({i, hit});
+        }
+    }
+
+    ASSERT_EQ(hits.size(), expected.size());
+    EXPECT_EQ(hits.size(), 150);
+    for (std::size_t i{}; i < hits.size(); ++i) {
+        EXPECT_EQ(hits[i].circle_index, expected[i].circle_index);
+        EXPECT_EQ(hits[i].hit.t_a, expected[i].hit.t_a);
+        EXPECT_EQ(hits[i].hit.t_b, expected[i].hit.t_b);
+    }
+
+    // Both orientations of the axis land in the parallel cells, the tilted circles do not
+    std::size_t candidate_count{};
+    for (const auto cell : index.get_parallel_cells(axis)) {
+        candidate_count += index.get_cell(cell).size();
+    }
+    EXPECT_EQ(candidate_count, 225);
+}
+
+} // namespace intersection3d
+} // namespace curves
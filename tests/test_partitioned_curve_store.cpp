@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/parallel/NumaTopology.h"
+#include "curves/parallel/PartitionedCurveStore.h"
+#include "curves/parallel/Reduction.h"
+
+namespace curves {
+namespace parallel {
+
+class PartitionedCurveStore_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i{}; i < 1000; ++i) {
+            curves.push_back(model3d::CurveFactory::create_random_curve());
+        }
+    }
+
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+};
+
+TEST_F(PartitionedCurveStore_test, topology) {
+    EXPECT_EQ(NumaTopology::parse_list("0-3,8,10-11\n"), (std::vector<std::size_t>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_TRUE(NumaTopology::parse_list("").empty());
+
+    const auto& topology{NumaTopology::get()};
+    EXPECT_GE(topology.get_node_count(), 1);
+    EXPECT_EQ(topology.is_numa(), topology.get_node_count() > 1);
+}
+
+TEST_F(PartitionedCurveStore_test, parallel_for_partitions) {
+    Executor executor{4};
+    const std::vector<Partition> partitions{{0, 100}, {1, 0}, {2, 37}, {0, 1}};
+
+    std::vector<std::vector<std::atomic<int>>> visits;
+    for (const auto& partition : partitions) {
+        visits.emplace_back(partition.count);
+    }
+    executor.parallel_for_partitions(
+        partitions, 8, [&](std::size_t partition, std::size_t begin, std::size_t end, std::size_t worker_index) {
+            EXPECT_LT(worker_index, executor.get_thread_count());
+            for (std::size_t i{begin}; i < end; ++i) {
+                visits[partition][i].fetch_add(1);
+            }
+        });
+
+    for (const auto& partition : visits) {
+        for (const auto& count : partition) {
+            EXPECT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST_F(PartitionedCurveStore_test, task_errors) {
+    Executor executor{4};
+    std::atomic<std::size_t> chunk_count{};
+    const auto throwing_task{[&](std::size_t, std::size_t, std::size_t) {
+        ++chunk_count;
+        throw std::runtime_error{"task"};
+    }};
+    EXPECT_THROW(executor.parallel_for(100000, 10, throwing_task), std::runtime_error);
+    EXPECT_LE(chunk_count, executor.get_thread_count()); // A worker stops at its first failed chunk
+
+    // The executor keeps working after the failed job
+    std::atomic<std::size_t> item_count{};
+    executor.parallel_for(
+        1000, 10, [&](std::size_t begin, std::size_t end, std::size_t) { item_count += end - begin; });
+    EXPECT_EQ(item_count, 1000);
+}
+
+TEST_F(PartitionedCurveStore_test, build) {
+    Executor executor{4};
+    const auto store{PartitionedCurveStore::build(curves, executor)};
+    ASSERT_TRUE(store);
+    ASSERT_EQ(store->size(), curves.size());
+
+    for (std::size_t partition{}; partition < store->get_partition_count(); ++partition) {
+        const auto& part{store->get_partition(partition)};
+        for (std::size_t i{}; i < part.size(); ++i) {
+            const auto& original{*curves[store->get_offset(partition) + i]};
+            EXPECT_EQ(part[i].get_point(1.0).data(), original.get_point(1.0).data());
+        }
+    }
+
+    // Node-local reduction: sum of the circle radii, one partial sum per worker
+    std::vector<double> partial_sums(executor.get_thread_count());
+    executor.parallel_for_partitions(store->get_partitions(),
+        64,
+        [&](std::size_t partition, std::size_t begin, std::size_t end, std::size_t worker_index) {
+            const auto circles{store->get_partition(partition).get_circles()};
+            const auto& entries{store->get_partition(partition).get_entries()};
+            for (std::size_t i{begin}; i < end; ++i) {
+                if (entries[i].type == model3d::CurveFactory::Curve_type::circle) {
+                    partial_sums[worker_index] += circles[entries[i].index].get_radius();
+                }
+            }
+        });
+
+    double expected{};
+    for (const auto& curve : curves) {
+        if (const auto circle{std::dynamic_pointer_cast<model3d::Circle>(curve)}) {
+            expected += circle->get_radius();
+        }
+    }
+    EXPECT_NEAR(std::accumulate(partial_sums.begin(), partial_sums.end(), 0.0), expected, 1e-9 * expected);
+
+    // The same through the partitioned reduction, independent of the executor
+    const auto get_radius = [&](std::size_t partition, std::size_t i) {
+        const auto& part{store->get_partition(partition)};
+        const auto& entry{part.get_entries()[i]};
+        return entry.type == model3d::CurveFactory::Curve_type::circle ? part.get_circles()[entry.index].get_radius()
+                                                                        : 0.0;
+    };
+    const double partitioned_sum{sum(store->get_partitions(), get_radius, &executor)};
+    EXPECT_NEAR(partitioned_sum, expected, 1e-12 * expected);
+    EXPECT_EQ(partitioned_sum, sum(store->get_partitions(), get_radius));
+}
+
+TEST_F(PartitionedCurveStore_test, node_bound_partitions) {
+    Executor executor{4};
+    const auto node_count{NumaTopology::get().get_node_count()};
+    std::vector<Partition> partitions;
+    for (std::size_t node{}; node < 2 * node_count; ++node) {
+        partitions.push_back({node, 50, true});
+    }
+
+    std::atomic<std::size_t> visited{};
+    executor.parallel_for_partitions(
+        partitions, 4, [&](std::size_t partition, std::size_t begin, std::size_t end, std::size_t worker_index) {
+            EXPECT_EQ(executor.get_worker_node(worker_index), partitions[partition].node % node_count);
+            visited.fetch_add(end - begin);
+        });
+    EXPECT_EQ(visited.load(), 100 * node_count);
+}
+
+} // namespace parallel
+} // namespace curves
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include "curves/intersection3d/PrimitiveIntersection.h"
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+
+namespace curves {
+namespace intersection3d {
+
+using model3d::CurveFactory;
+
+class PrimitiveIntersection_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const Point3d origin{0.0, 0.0, 0.0};
+        const Vector3d axis{0.0, 0.0, 1.0};
+        const Vector3d start_direction{1.0, 0.0, 0.0};
+        circle = CurveFactory::create_circle(origin, 1.0, axis, start_direction);
+        ellipse = CurveFactory::create_ellipse(origin, 2.0, 1.0, axis, start_direction);
+        helix = CurveFactory::create_helix(origin, 1.0, math::two_pi, axis, start_direction); // z = t
+    }
+
+    std::shared_ptr<model3d::Circle> circle;
+    std::shared_ptr<model3d::Ellipse> ellipse;
+    std::shared_ptr<model3d::Helix> helix;
+};
+
+TEST_F(PrimitiveIntersection_test, plane) {
+    { // Circle: cos(t) = 0.5
+        const auto& hits{intersect(*circle, Plane{Point3d{0.5, 0.0, 0.0}, Vector3d{2.0, 0.0, 0.0}})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_NEAR(hits[0].t, math::pi / 3.0, math::precision);
+        EXPECT_NEAR(hits[1].t, 5.0 * math::pi / 3.0, math::precision);
+        EXPECT_EQ(hits[0].kind, Intersection_kind::transversal);
+    }
+
+    { // Circle touches the plane
+        const auto& hits{intersect(*circle, Plane{Point3d{0.0, 1.0, 0.0}, Vector3d{0.0, 1.0, 0.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(hits[0].t, math::half_pi, math::precision);
+        EXPECT_EQ(hits[0].kind, Intersection_kind::tangent);
+    }
+
+    { // Circle lies in the plane
+        const auto& hits{intersect(*circle, Plane{Point3d{0.0, 0.0, 0.0}, Vector3d{0.0, 0.0, 1.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_EQ(hits[0].kind, Intersection_kind::overlap);
+    }
+
+    { // Ellipse: sin(t) = 0.5
+        const auto& hits{intersect(*ellipse, Plane{Point3d{0.0, 0.5, 0.0}, Vector3d{0.0, 1.0, 0.0}})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_NEAR(hits[0].t, math::pi / 6.0, math::precision);
+        EXPECT_NEAR(hits[1].t, 5.0 * math::pi / 6.0, math::precision);
+    }
+
+    { // Helix crosses the plane perpendicular to its axis once
+        const auto& hits{intersect(*helix, Plane{Point3d{0.0, 0.0, 30.0}, Vector3d{0.0, 0.0, 1.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(hits[0].t, 30.0, math::precision);
+        EXPECT_TRUE(math::equal(hits[0].point, Point3d{std::cos(30.0), std::sin(30.0), 30.0}, math::precision));
+    }
+
+    { // Tilted plane z = x + 4: roots of cos(t) - t + 4 = 0
+        const auto& hits{intersect(*helix, Plane{Point3d{0.0, 0.0, 4.0}, Vector3d{-1.0, 0.0, 1.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(std::cos(hits[0].t) - hits[0].t + 4.0, 0.0, math::precision);
+    }
+
+    { // Plane parallel to the axis cuts every turn
+        const Plane plane{Point3d{0.5, 0.0, 0.0}, Vector3d{1.0, 0.0, 0.0}};
+        EXPECT_EQ(intersect(*helix, plane).size(), 2);
+        EXPECT_EQ(intersect(*helix, plane, math::precision, ParameterRange{0.0, 2.0 * math::two_pi}).size(), 4);
+    }
+}
+
+TEST_F(PrimitiveIntersection_test, line_and_ray) {
+    { // Line in the plane of the circle
+        const auto& hits{intersect(*circle, Line{Point3d{-5.0, 0.0, 0.0}, Vector3d{1.0, 0.0, 0.0}})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_NEAR(hits[0].t, 0.0, math::precision);
+        EXPECT_NEAR(hits[1].t, math::pi, math::precision);
+    }
+
+    { // Line crossing the plane of the ellipse at its point
+        const auto& hits{intersect(*ellipse, Line{Point3d{0.0, 1.0, -1.0}, Vector3d{0.0, 0.0, 3.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(hits[0].t, math::half_pi, math::precision);
+    }
+
+    { // Ray starting inside the circle
+        const auto& hits{intersect(*circle, Ray{Point3d{0.0, 0.0, 0.0}, Vector3d{0.0, 1.0, 0.0}})};
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_NEAR(hits[0].t, math::half_pi, math::precision);
+    }
+
+    { // Line through the helix point at t = 7
+        const Point3d point{std::cos(7.0), std::sin(7.0), 7.0};
+        const auto& hits{intersect(*helix, Line{point, Vector3d{1.0, 2.0, 0.5}})};
+        ASSERT_FALSE(hits.empty());
+        EXPECT_TRUE(std::ranges::any_of(hits, [](const PrimitiveHit& hit) { return std::abs(hit.t - 7.0) < 1e-9; }));
+    }
+
+    { // Line on the helix cylinder parallel to the axis
+        const Line line{Point3d{0.0, 1.0, 0.0}, Vector3d{0.0, 0.0, 1.0}};
+        EXPECT_EQ(intersect(*helix, line, math::precision, ParameterRange{0.0, 3.0 * math::two_pi}).size(), 3);
+    }
+}
+
+TEST_F(PrimitiveIntersection_test, sphere) {
+    { // Circle: two points at distance 1 from (1, 0, 0)
+        const auto& hits{intersect(*circle, Sphere{Point3d{1.0, 0.0, 0.0}, 1.0})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_NEAR(hits[0].t, math::pi / 3.0, math::precision);
+        EXPECT_NEAR(hits[1].t, 5.0 * math::pi / 3.0, math::precision);
+    }
+
+    { // Ellipse touches the sphere around the center from inside
+        const auto& hits{intersect(*ellipse, Sphere{Point3d{0.0, 0.0, 0.0}, 1.0})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0].kind, Intersection_kind::tangent);
+        EXPECT_NEAR(hits[0].t, math::half_pi, math::precision);
+    }
+
+    { // Helix: 2 - 2 * cos(t) + t^2 = 0.25
+        const auto& hits{intersect(*helix, Sphere{Point3d{1.0, 0.0, 0.0}, 0.5})};
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_NEAR(hits[0].t, -hits[1].t, math::precision);
+        for (const auto& hit : hits) {
+            EXPECT_NEAR(std::sqrt(math::get_sqr_distance(hit.point, Point3d{1.0, 0.0, 0.0})), 0.5, math::precision);
+        }
+    }
+
+    { // Large sphere around a dense helix: only the turns near the two crossing heights are searched
+        const auto dense{
+            model3d::CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 1.0, 1e-4, Vector3d{0.0, 0.0, 1.0})};
+        ASSERT_TRUE(dense);
+        const auto& hits{intersect(*dense, Sphere{Point3d{0.0, 0.0, 0.0}, 100.0})};
+        ASSERT_EQ(hits.size(), 2);
+        for (const auto& hit : hits) {
+            EXPECT_NEAR(std::sqrt(math::get_sqr_distance(hit.point, Point3d{0.0, 0.0, 0.0})), 100.0, 1e-8);
+        }
+    }
+
+    { // Sphere through the axis of a dense helix, it crosses every turn of the slab twice
+        const auto dense{
+            model3d::CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 1.0, 1e-2, Vector3d{0.0, 0.0, 1.0})};
+        ASSERT_TRUE(dense);
+        const Sphere sphere{Point3d{100.0, 0.0, 0.0}, 100.0};
+        const auto& hits{intersect(*dense, sphere)};
+        EXPECT_GT(hits.size(), 2 * 2000);
+        for (const auto& hit : hits) {
+            // Grazing hits at the ends of the slab are tangent within the precision
+            EXPECT_NEAR(std::sqrt(math::get_sqr_distance(hit.point, sphere.center)), 100.0, math::precision);
+        }
+    }
+}
+
+TEST_F(PrimitiveIntersection_test, slice) {
+    const std::vector<std::shared_ptr<model3d::Curve>> curves{helix, circle, ellipse};
+    const std::vector<double> offsets{0.0, 2.0, 1.0};
+
+    const auto& hits{slice(curves, Vector3d{0.0, 0.0, 2.0}, offsets)};
+
+    // The helix crosses each plane once, circle and ellipse lie in the first plane
+    ASSERT_EQ(hits.size(), 5);
+    EXPECT_EQ(hits[0].curve_index, 0);
+    EXPECT_EQ(hits[1].plane_index, 1);
+    EXPECT_NEAR(hits[1].hit.t, 1.0, math::precision); // 2 * z = 2
+    EXPECT_EQ(hits[2].plane_index, 2);
+    EXPECT_NEAR(hits[2].hit.t, 0.5, math::precision);
+    EXPECT_EQ(hits[3].curve_index, 1);
+    EXPECT_EQ(hits[3].hit.kind, Intersection_kind::overlap);
+    EXPECT_EQ(hits[4].curve_index, 2);
+}
+
+} // namespace intersection3d
+} // namespace curves
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "curves/index/RadiusBTree.h"
+#include "curves/index/RadiusIndex.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace index {
+
+class RadiusIndex_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937_64 generator{42};
+        std::uniform_int_distribution<int> distribution{1, 5000}; // Plenty of equal radii
+        for (std::size_t i{}; i < 40000; ++i) {
+            radii.push_back(static_cast<double>(distribution(generator)) / 10.0);
+        }
+    }
+
+    std::vector<RadiusItem> get_reference() const {
+        std::vector<RadiusItem> items;
+        for (std::size_t i{}; i < radii.size(); ++i) {
+            items.push_back({radii[i], static_cast<std::uint32_t>(i)});
+        }
+        std::sort(items.begin(), items.end());
+        return items;
+    }
+
+    static std::size_t get_rank(const std::vector<RadiusItem>& items, double radius) {
+        return static_cast<std::size_t>(std::count_if(
+            items.begin(), items.end(), [radius](const RadiusItem& item) { return item.radius < radius; }));
+    }
+
+    // Distances of the k nearest, the order among equal distances is not compared
+    static std::vector<double> get_distances(const std::vector<RadiusItem>& items, double radius) {
+        std::vector<double> distances;
+        for (const auto& item : items) {
+            distances.push_back(std::abs(item.radius - radius));
+        }
+        return distances;
+    }
+
+    std::vector<double> radii;
+};
+
+TEST_F(RadiusIndex_test, static_index) {
+    parallel::Executor executor{4};
+    const auto index{RadiusIndex::build(radii, &executor)};
+    const auto reference{get_reference()};
+    ASSERT_EQ(index.size(), radii.size());
+    EXPECT_TRUE(std::equal(index.get_items().begin(), index.get_items().end(), reference.begin()));
+
+    for (const double radius : {0.0, 0.1, 0.15, 250.0, 250.05, 500.0, 1000.0}) {
+        EXPECT_EQ(index.rank(radius), get_rank(reference, radius)) << radius;
+    }
+
+    const auto range{index.range(10.0, 12.0)};
+    EXPECT_EQ(range.size(), get_rank(reference, 12.05) - get_rank(reference, 10.0));
+    EXPECT_EQ(range.front().radius, 10.0);
+    EXPECT_EQ(range.back().radius, 12.0);
+    EXPECT_TRUE(index.range(3.0, 2.0).empty());
+
+    const auto nearest{index.nearest(123.45, 25)};
+    ASSERT_EQ(nearest.size(), 25);
+    auto distances{get_distances(reference, 123.45)};
+    std::sort(distances.begin(), distances.end());
+    for (std::size_t i{}; i < nearest.size(); ++i) {
+        EXPECT_DOUBLE_EQ(std::abs(nearest[i].radius - 123.45), distances[i]);
+    }
+    EXPECT_EQ(index.nearest(1.0, 100000).size(), radii.size());
+}
+
+TEST_F(RadiusIndex_test, btree) {
+    auto tree{RadiusBTree::build(std::span{radii}.first(20000))};
+
+    // Second half inserted one by one, then every third item erased
+    for (std::uint32_t id{20000}; id < radii.size(); ++id) {
+        tree.insert({radii[id], id});
+    }
+    auto reference{get_reference()};
+    for (std::uint32_t id{}; id < radii.size(); id += 3) {
+        EXPECT_TRUE(tree.erase({radii[id], id}));
+        EXPECT_FALSE(tree.erase({radii[id], id}));
+    }
+    std::erase_if(reference, [](const RadiusItem& item) { return item.id % 3 == 0; });
+    ASSERT_EQ(tree.size(), reference.size());
+
+    const auto all{tree.range(0.0, 1000.0)};
+    EXPECT_TRUE(std::equal(all.begin(), all.end(), reference.begin(), reference.end()));
+
+    for (const double radius : {0.0, 0.1, 0.15, 250.0, 250.05, 500.0, 1000.0}) {
+        EXPECT_EQ(tree.rank(radius), get_rank(reference, radius)) << radius;
+    }
+
+    const auto nearest{tree.nearest(77.77, 40)};
+    ASSERT_EQ(nearest.size(), 40);
+    auto distances{get_distances(reference, 77.77)};
+    std::sort(distances.begin(), distances.end());
+    for (std::size_t i{}; i < nearest.size(); ++i) {
+        EXPECT_DOUBLE_EQ(std::abs(nearest[i].radius - 77.77), distances[i]);
+    }
+
+    // Emptied completely
+    for (const auto& item : reference) {
+        EXPECT_TRUE(tree.erase(item));
+    }
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_TRUE(tree.nearest(1.0, 3).empty());
+    tree.insert({1.0, 7});
+    EXPECT_EQ(tree.rank(2.0), 1);
+}
+
+} // namespace index
+} // namespace curves
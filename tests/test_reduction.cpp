@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/parallel/Reduction.h"
+
+namespace curves {
+namespace parallel {
+
+class Reduction_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Same spread as the radii of random circles
+        std::mt19937_64 generator{7};
+        std::uniform_real_distribution<double> exponent{-5.0, 6.0};
+        for (std::size_t i{}; i < 100003; ++i) {
+            values.push_back(std::pow(10.0, exponent(generator)));
+        }
+    }
+
+    std::vector<double> values;
+};
+
+TEST_F(Reduction_test, reproducible_for_any_thread_count) {
+    const double expected{sum(values)};
+    for (const std::size_t thread_count : {1, 2, 3, 8}) {
+        Executor executor{thread_count};
+        EXPECT_EQ(sum(values, &executor), expected) << thread_count;
+    }
+}
+
+TEST_F(Reduction_test, accuracy) {
+    long double reference{};
+    for (const double value : values) {
+        reference += value;
+    }
+    EXPECT_NEAR(sum(values), static_cast<double>(reference), std::abs(static_cast<double>(reference)) * 1e-15);
+
+    // Plain summation loses every 1.0 here
+    std::vector<double> cancelling;
+    for (std::size_t i{}; i < 10000; ++i) {
+        cancelling.insert(cancelling.end(), {1e16, 1.0, -1e16});
+    }
+    Executor executor{4};
+    EXPECT_EQ(sum(cancelling, &executor), 10000.0);
+
+    EXPECT_EQ(sum(std::span<const double>{}), 0.0);
+    EXPECT_EQ(sum(std::span<const double>{values.data(), 1}), values[0]);
+}
+
+TEST_F(Reduction_test, projection) {
+    std::vector<std::shared_ptr<model3d::Circle>> circles;
+    for (std::size_t i{}; i < 10000; ++i) {
+        circles.push_back(*model3d::CurveFactory::try_create_circle(
+            model3d::Point3d{0.0, 0.0, 0.0}, static_cast<double>(i % 100 + 1), model3d::Vector3d{0.0, 0.0, 1.0}));
+    }
+
+    const auto get_radius = [](const std::shared_ptr<model3d::Circle>& circle) { return circle->get_radius(); };
+    Executor executor{3};
+    const auto circle_span{std::span<const std::shared_ptr<model3d::Circle>>{circles}};
+    EXPECT_EQ(sum(circle_span, get_radius, &executor), 100.0 * 5050.0);
+    EXPECT_EQ(sum(circle_span, get_radius), sum(circle_span, get_radius, &executor));
+}
+
+} // namespace parallel
+} // namespace curves
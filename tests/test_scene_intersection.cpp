@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "curves/intersection3d/SceneIntersection.h"
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/Helix.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace intersection3d {
+
+using model3d::CurveFactory;
+using model3d::Vector3d;
+
+namespace {
+
+// Helices along z spread over a square of the given size, and circles of which every other one is placed through
+// a point of a helix, so the scene has as many hits as circles / 2 plus the random ones
+std::vector<std::shared_ptr<model3d::Curve>> create_scene(std::size_t helix_count,
+    std::size_t circle_count,
+    double size,
+    std::uint64_t seed) {
+    std::mt19937_64 generator{seed};
+    std::uniform_real_distribution<double> coordinate{0.0, size};
+    std::uniform_real_distribution<double> angle{0.0, math::two_pi};
+    std::uniform_real_distribution<double> radius{0.5, 2.0};
+    const Vector3d axis{0.0, 0.0, 1.0};
+
+    std::vector<std::shared_ptr<model3d::Helix>> helices{};
+    std::vector<std::shared_ptr<model3d::Curve>> curves{};
+    for (std::size_t i{}; i < helix_count; ++i) {
+        helices.push_back(
+            CurveFactory::create_helix(Point3d{coordinate(generator), coordinate(generator), 0.0}, radius(generator),
+                radius(generator), axis));
+        curves.push_back(helices.back());
+    }
+    for (std::size_t i{}; i < circle_count; ++i) {
+        const double circle_radius{radius(generator)};
+        if (i % 2 == 0) {
+            const auto& helix{*helices[i / 2 % helix_count]};
+            const auto point{helix.get_point(angle(generator))};
+            const double direction{angle(generator)};
+            const Vector3d offset{std::cos(direction) * circle_radius, std::sin(direction) * circle_radius, 0.0};
+            curves.push_back(CurveFactory::create_circle(math::translate(point, offset), circle_radius, axis));
+        } else {
+            curves.push_back(CurveFactory::create_circle(
+                Point3d{coordinate(generator), coordinate(generator), 0.0}, circle_radius, axis));
+        }
+    }
+    return curves;
+}
+
+} // namespace
+
+class SceneIntersection_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const Vector3d axis{0.0, 0.0, 1.0};
+        const Vector3d start_direction{1.0, 0.0, 0.0};
+        curves.push_back(CurveFactory::create_circle(Point3d{0.0, 0.0, 0.5}, 1.0, axis, start_direction)); // hit
+        curves.push_back(CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 1.0, 2.0, axis, start_direction));
+        curves.push_back(CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 2.0, axis)); // hit
+        curves.push_back(CurveFactory::create_ellipse(Point3d{0.0, 0.0, 0.0}, 2.0, 1.0, axis)); // no solver
+        curves.push_back(CurveFactory::create_circle(Point3d{1.0, 0.0, 3.0}, 2.0, axis, start_direction)); // hit
+        curves.push_back(CurveFactory::create_helix(Point3d{0.0, 0.0, 0.0}, 2.0, 2.0, axis, start_direction));
+        curves.push_back(CurveFactory::create_circle(Point3d{100.0, 0.0, 0.0}, 1.0, axis)); // culled
+    }
+
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+};
+
+TEST_F(SceneIntersection_test, find_all_intersections) {
+    parallel::Executor executor{4};
+    const auto& result{find_all_intersections(curves, math::precision, executor)};
+
+    // Helix 1 hits the circle 0 at t = pi/2 and the circle 4 at t = 3pi, helix 5 hits the circle 2 at t = 0
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].first_index, 0);
+    EXPECT_EQ(result[0].second_index, 1);
+    EXPECT_TRUE(math::equal(result[0].hit.point, Point3d{0.0, 1.0, 0.5}, math::precision));
+    EXPECT_NEAR(result[0].hit.t_a, math::half_pi, math::precision); // Circle 0
+    EXPECT_NEAR(result[0].hit.t_b, math::half_pi, math::precision); // Helix 1
+    EXPECT_EQ(result[1].first_index, 1);
+    EXPECT_EQ(result[1].second_index, 4);
+    EXPECT_TRUE(math::equal(result[1].hit.point, Point3d{-1.0, 0.0, 3.0}, math::precision));
+    EXPECT_NEAR(result[1].hit.t_a, 3.0 * math::pi, math::precision); // Helix 1
+    EXPECT_NEAR(result[1].hit.t_b, math::pi, math::precision); // Circle 4
+    EXPECT_EQ(result[2].first_index, 2);
+    EXPECT_EQ(result[2].second_index, 5);
+
+    parallel::Executor single_executor{1};
+    const auto& single_result{find_all_intersections(curves, math::precision, single_executor)};
+    ASSERT_EQ(single_result.size(), result.size());
+    for (std::size_t i{}; i < result.size(); ++i) {
+        EXPECT_EQ(single_result[i].first_index, result[i].first_index);
+        EXPECT_EQ(single_result[i].second_index, result[i].second_index);
+        EXPECT_TRUE(math::equal(single_result[i].hit.point, result[i].hit.point, 0.0));
+    }
+}
+
+TEST(SceneIntersection_scene_test, matches_all_pairs) {
+    const auto curves{create_scene(100, 1000, 40.0, 5)};
+    parallel::Executor executor{4};
+    const auto& result{find_all_intersections(curves, math::precision, executor)};
+
+    std::vector<std::pair<std::size_t, std::size_t>> expected{};
+    for (std::size_t h{}; h < 100; ++h) {
+        const auto& helix{static_cast<const model3d::Helix&>(*curves[h])};
+        for (std::size_t c{100}; c < curves.size(); ++c) {
+            const auto& hits{get_intersection_hits(helix, static_cast<const model3d::Circle&>(*curves[c]))};
+            for (std::size_t i{}; i < hits.size(); ++i) {
+                expected.emplace_back(h, c);
+            }
+        }
+    }
+
+    ASSERT_GE(expected.size(), 500);
+    ASSERT_EQ(result.size(), expected.size());
+    for (std::size_t i{}; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].first_index, expected[i].first);
+        EXPECT_EQ(result[i].second_index, expected[i].second);
+    }
+}
+
+// 10^9 helix-circle pairs, out of reach for testing every pair
+TEST(SceneIntersection_scene_test, large_scene) {
+    constexpr std::size_t helix_count{5000};
+    constexpr std::size_t circle_count{200000};
+    const auto curves{create_scene(helix_count, circle_count, 2000.0, 9)};
+    parallel::Executor executor{4};
+    const auto& result{find_all_intersections(curves, math::precision, executor)};
+
+    // Every circle placed through a helix is found
+    std::vector<bool> found(curves.size());
+    for (const auto& intersection : result) {
+        EXPECT_LT(intersection.first_index, helix_count);
+        found[intersection.second_index] = true;
+    }
+    for (std::size_t c{helix_count}; c < curves.size(); c += 2) {
+        ASSERT_TRUE(found[c]) << c;
+    }
+}
+
+TEST_F(SceneIntersection_test, cancellation) {
+    parallel::Executor executor{2};
+    parallel::JobControl control{};
+    control.cancel();
+
+    EXPECT_TRUE(find_all_intersections(curves, math::precision, executor, &control).empty());
+}
+
+} // namespace intersection3d
+} // namespace curves
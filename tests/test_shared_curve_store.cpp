@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/model3d/SharedCurveStore.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace curves {
+namespace model3d {
+
+class SharedCurveStore_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _name = "/curves_test_" + std::to_string(getpid());
+        for (std::size_t i{}; i < 500; ++i) {
+            _curves.push_back(CurveFactory::create_random_curve());
+        }
+    }
+
+    void TearDown() override {
+        SharedCurveStore::remove(_name);
+    }
+
+    std::string _name;
+    std::vector<std::shared_ptr<Curve>> _curves;
+};
+
+TEST_F(SharedCurveStore_test, publish_and_read) {
+    auto writer{SharedCurveStore::create(_name, 1000)};
+    ASSERT_TRUE(writer);
+    EXPECT_TRUE(writer->is_writable());
+    EXPECT_EQ(writer->get_capacity(), 1000);
+
+    auto reader{SharedCurveStore::open(_name)};
+    ASSERT_TRUE(reader);
+    EXPECT_FALSE(reader->is_writable());
+    EXPECT_FALSE(reader->get_snapshot());
+    EXPECT_FALSE(reader->publish(_curves));
+
+    EXPECT_EQ(writer->publish(_curves), 1);
+    const auto view{reader->get_snapshot()};
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->get_version(), 1);
+    ASSERT_EQ(view->size(), _curves.size());
+
+    // Evaluated in place, the decoded curves match as well
+    for (std::size_t i{}; i < _curves.size(); ++i) {
+        for (const double t : {-3.0, 0.0, 0.7, 12.5}) {
+            EXPECT_TRUE(math::equal(view->get_point(i, t), _curves[i]->get_point(t), 1e-6));
+            EXPECT_TRUE(math::equal(view->get_first_derivative(i, t), _curves[i]->get_first_derivative(t), 1e-6));
+        }
+        const auto decoded{view->decode(i)};
+        ASSERT_TRUE(decoded);
+        EXPECT_TRUE(math::equal(decoded->get_point(1.0), _curves[i]->get_point(1.0), 1e-6));
+    }
+    EXPECT_TRUE(view->is_valid());
+}
+
+TEST_F(SharedCurveStore_test, snapshots) {
+    auto writer{SharedCurveStore::create(_name, 1000)};
+    ASSERT_TRUE(writer);
+    auto reader{SharedCurveStore::open(_name)};
+    ASSERT_TRUE(reader);
+
+    ASSERT_TRUE(writer->publish(std::span{_curves}.first(100)));
+    const auto first{reader->get_snapshot()};
+    ASSERT_TRUE(first);
+
+    // The next version goes to the other slot, the view stays valid until its own slot is written again
+    ASSERT_TRUE(writer->publish(std::span{_curves}.first(200)));
+    EXPECT_TRUE(first->is_valid());
+    const auto second{reader->get_snapshot()};
+    ASSERT_TRUE(second);
+    EXPECT_EQ(second->get_version(), 2);
+    EXPECT_EQ(second->size(), 200);
+
+    ASSERT_TRUE(writer->publish(CurveStore::compact(std::span{_curves}.first(300)).value()));
+    EXPECT_FALSE(first->is_valid());
+    EXPECT_TRUE(second->is_valid());
+    EXPECT_EQ(reader->get_version(), 3);
+    EXPECT_EQ(reader->get_snapshot()->size(), 300);
+
+    // Over capacity: nothing changes for the readers
+    std::vector<std::shared_ptr<Curve>> too_many(1001, _curves.front());
+    EXPECT_FALSE(writer->publish(too_many));
+    EXPECT_EQ(reader->get_version(), 3);
+    EXPECT_TRUE(second->is_valid());
+
+    EXPECT_FALSE(SharedCurveStore::open("/curves_test_missing"));
+}
+
+TEST_F(SharedCurveStore_test, other_process) {
+    auto writer{SharedCurveStore::create(_name, 1000)};
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(writer->publish(_curves));
+    const auto expected{_curves[42]->get_point(2.0)};
+
+    // The child maps the segment at its own address
+    const pid_t child{fork()};
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        const auto reader{SharedCurveStore::open(_name)};
+        const auto view{reader ? reader->get_snapshot() : std::nullopt};
+        const bool same{view && view->size() == 500 && math::equal(view->get_point(42, 2.0), expected, 1e-6)};
+        _exit(same ? 0 : 1);
+    }
+
+    int status{};
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "curves/index/SpatialOrder.h"
+#include "curves/model3d/Curve.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/CurveStore.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace index {
+
+TEST(SpatialOrder_test, morton_key) {
+    EXPECT_EQ(get_morton_key(1, 0, 0), 1);
+    EXPECT_EQ(get_morton_key(0, 1, 0), 2);
+    EXPECT_EQ(get_morton_key(0, 0, 1), 4);
+    EXPECT_EQ(get_morton_key(3, 0, 0), 9);
+    EXPECT_EQ(get_morton_key((1u << 21) - 1, (1u << 21) - 1, (1u << 21) - 1), (1ull << 63) - 1);
+}
+
+TEST(SpatialOrder_test, hilbert_key) {
+    // The first 8^3 keys fill the cube at the origin, every step goes to a face neighbour
+    std::vector<std::pair<std::uint64_t, std::array<std::uint32_t, 3>>> cells;
+    for (std::uint32_t x{}; x < 8; ++x) {
+        for (std::uint32_t y{}; y < 8; ++y) {
+            for (std::uint32_t z{}; z < 8; ++z) {
+                cells.push_back({get_hilbert_key(x, y, z), {x, y, z}});
+            }
+        }
+    }
+    std::sort(cells.begin(), cells.end());
+
+    for (std::size_t i{}; i < cells.size(); ++i) {
+        EXPECT_EQ(cells[i].first, i);
+        if (i > 0) {
+            std::uint32_t step{};
+            for (std::size_t axis{}; axis < 3; ++axis) {
+                step += cells[i].second[axis] > cells[i - 1].second[axis]
+                    ? cells[i].second[axis] - cells[i - 1].second[axis]
+                    : cells[i - 1].second[axis] - cells[i].second[axis];
+            }
+            EXPECT_EQ(step, 1) << i;
+        }
+    }
+}
+
+TEST(SpatialOrder_test, reorder) {
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+    for (std::size_t i{}; i < 20000; ++i) {
+        curves.push_back(model3d::CurveFactory::create_random_curve());
+    }
+    const auto original{curves};
+
+    parallel::Executor executor{4};
+    const auto serial_order{get_spatial_order(curves, Spatial_key::hilbert)};
+    const auto order{reorder_spatially(curves, Spatial_key::hilbert, &executor)};
+    EXPECT_EQ(order, serial_order);
+
+    // A permutation, applied to the curves, following the keys
+    std::vector<bool> seen(curves.size());
+    for (std::size_t i{}; i < order.size(); ++i) {
+        ASSERT_LT(order[i], curves.size());
+        EXPECT_FALSE(seen[order[i]]);
+        seen[order[i]] = true;
+        EXPECT_EQ(curves[i], original[order[i]]);
+    }
+
+    std::vector<Point3d> centers;
+    for (const auto& curve : curves) {
+        centers.push_back(get_center(*curve));
+    }
+    const auto keys{get_spatial_keys(centers, Spatial_key::hilbert)};
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // Equal keys keep the input order
+    const std::vector<Point3d> same(5, Point3d{1.0, 2.0, 3.0});
+    EXPECT_EQ(get_spatial_order(same, Spatial_key::morton), (std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(SpatialOrder_test, reorder_store) {
+    std::vector<std::shared_ptr<model3d::Curve>> curves;
+    for (std::size_t i{}; i < 1000; ++i) {
+        curves.push_back(model3d::CurveFactory::create_random_curve());
+    }
+    auto store{*model3d::CurveStore::compact(curves)};
+
+    const auto order{reorder_spatially(store, Spatial_key::morton)};
+    ASSERT_EQ(store.size(), curves.size());
+    for (std::size_t i{}; i < store.size(); ++i) {
+        EXPECT_EQ(store[i].get_point(0.5).data(), curves[order[i]]->get_point(0.5).data());
+    }
+    EXPECT_EQ(store.get_circles().size() + store.get_ellipses().size() + store.get_helices().size(), curves.size());
+}
+
+} // namespace index
+} // namespace curves
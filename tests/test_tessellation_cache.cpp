@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/Constants.h"
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Ellipse.h"
+#include "curves/model3d/TessellationCache.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+// Curve defined outside the library, without its own acceleration bound
+class Forwarding_curve : public Curve {
+public:
+    explicit Forwarding_curve(std::shared_ptr<Curve> curve) : _curve{std::move(curve)} {};
+
+    Point3d get_point(double t) const override { return _curve->get_point(t); };
+    Vector3d get_first_derivative(double t) const override { return _curve->get_first_derivative(t); };
+
+private:
+    std::shared_ptr<Curve> _curve;
+};
+
+} // namespace
+
+class TessellationCache_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        circle = CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, Vector3d{0.0, 0.0, 1.0});
+    }
+
+    std::shared_ptr<Circle> circle;
+};
+
+TEST_F(TessellationCache_test, get_level) {
+    // Segment length sqrt(8 * 1e-3) ~ 0.0894 -> 71 segments over 2pi -> 128
+    EXPECT_EQ(TessellationCache::get_level(*circle, 0.0, math::two_pi, 1e-3), 7);
+    EXPECT_EQ(TessellationCache::get_level(*circle, 0.0, math::two_pi, 10.0), 0);
+
+    // No level meets a tolerance that is not positive
+    EXPECT_FALSE(TessellationCache::get_level(*circle, 0.0, math::two_pi, 0.0));
+    EXPECT_FALSE(TessellationCache::get_level(*circle, 0.0, math::two_pi, -1e-3));
+    EXPECT_FALSE(TessellationCache::get_level(*circle, 0.0, math::two_pi, std::nan("")));
+
+    TessellationCache cache{1 << 20};
+    EXPECT_FALSE(cache.get(*circle, 0.0, math::two_pi, 0.0));
+    EXPECT_EQ(cache.get_size(), 0);
+}
+
+TEST_F(TessellationCache_test, default_max_acceleration) {
+    const auto ellipse{CurveFactory::create_ellipse(Point3d{1.0, 2.0, 3.0}, 5.0, 2.0, Vector3d{1.0, 1.0, 0.0})};
+    const Forwarding_curve curve{ellipse};
+
+    // The estimate bounds the exact value from above, within the safety margin
+    EXPECT_GE(curve.get_max_acceleration(), ellipse->get_max_acceleration());
+    EXPECT_LE(curve.get_max_acceleration(), 1.1 * ellipse->get_max_acceleration());
+
+    TessellationCache cache{1 << 20};
+    const auto points{cache.get(curve, 0.0, math::two_pi, 1e-3)};
+    ASSERT_TRUE(points);
+    EXPECT_EQ(points->size(), (std::size_t{1} << *TessellationCache::get_level(*ellipse, 0.0, math::two_pi, 1e-3)) + 1);
+}
+
+TEST_F(TessellationCache_test, get) {
+    TessellationCache cache{1 << 20};
+
+    const auto& fine{cache.get(*circle, 0.0, math::two_pi, 1e-4)};
+    ASSERT_EQ(fine->size(), 257);
+    for (std::size_t i{}; i < fine->size(); ++i) {
+        const double t{math::two_pi * static_cast<double>(i) / 256.0};
+        EXPECT_TRUE(math::equal((*fine)[i], circle->get_point(t), math::precision));
+    }
+
+    // Cached
+    EXPECT_EQ(cache.get(*circle, 0.0, math::two_pi, 1e-4), fine);
+    EXPECT_EQ(cache.get(*circle, 0.0, math::two_pi, 0.9e-4), fine);
+
+    // Derived from the finer level
+    const auto& coarse{cache.get(*circle, 0.0, math::two_pi, 1e-3)};
+    ASSERT_EQ(coarse->size(), 129);
+    for (std::size_t i{}; i < coarse->size(); ++i) {
+        EXPECT_TRUE(math::equal((*coarse)[i], (*fine)[2 * i], 0.0));
+    }
+    EXPECT_EQ(cache.get_size(), 2);
+
+    cache.invalidate(*circle);
+    EXPECT_EQ(cache.get_size(), 0);
+    EXPECT_EQ(cache.get_memory_usage(), 0);
+    EXPECT_EQ(fine->size(), 257); // Still owned by the caller
+}
+
+TEST_F(TessellationCache_test, eviction) {
+    const auto& other{CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 1.0, Vector3d{1.0, 0.0, 0.0})};
+    TessellationCache cache{300 * sizeof(Point3d)};
+
+    cache.get(*circle, 0.0, math::two_pi, 1e-4);
+    EXPECT_EQ(cache.get_size(), 1);
+
+    // The least recently used entry is evicted to stay within the memory limit
+    cache.get(*other, 0.0, math::two_pi, 1e-4);
+    EXPECT_EQ(cache.get_size(), 1);
+    EXPECT_LE(cache.get_memory_usage(), cache.get_max_memory());
+
+    const auto& first{cache.get(*other, 0.0, math::two_pi, 1e-4)};
+    EXPECT_EQ(cache.get(*other, 0.0, math::two_pi, 1e-4), first);
+}
+
+} // namespace model3d
+} // namespace curves
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "curves/model3d/CurveFactory.h"
+#include "curves/parallel/Executor.h"
+#include "curves/parallel/Trace.h"
+
+namespace curves {
+namespace parallel {
+
+class Trace_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Tracer::get().set_capacity(Tracer::default_capacity);
+    }
+
+    void TearDown() override {
+        Tracer::get().disable();
+        Tracer::get().set_capacity(Tracer::default_capacity);
+    }
+
+    static std::size_t count_events(const std::vector<TraceEvent>& events, std::string_view name) {
+        return std::count_if(
+            events.begin(), events.end(), [&](const TraceEvent& event) { return name == event.name; });
+    }
+};
+
+TEST_F(Trace_test, disabled) {
+    {
+        TraceSpan span{"disabled"};
+    }
+    model3d::CurveFactory::create_random_curve();
+    EXPECT_TRUE(Tracer::get().get_events().empty());
+}
+
+TEST_F(Trace_test, nested_spans) {
+    Tracer::get().enable();
+    {
+        TraceSpan outer{"outer"};
+        TraceSpan inner{"inner"};
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    Tracer::get().disable();
+
+    const auto events{Tracer::get().get_events()};
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_STREQ(events[0].name, "outer");
+    EXPECT_STREQ(events[1].name, "inner");
+    EXPECT_LE(events[0].start, events[1].start);
+    EXPECT_GE(events[0].start + events[0].duration, events[1].start + events[1].duration);
+    EXPECT_GE(events[1].duration, 1000000);
+    EXPECT_EQ(events[0].thread_id, events[1].thread_id);
+}
+
+TEST_F(Trace_test, instrumentation) {
+    Tracer::get().enable();
+    model3d::CurveFactory::create_random_circle();
+    Executor executor{4};
+    executor.parallel_for(1000, 10, [](std::size_t, std::size_t, std::size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds{10});
+    });
+    Tracer::get().disable();
+
+    const auto events{Tracer::get().get_events()};
+    EXPECT_EQ(count_events(events, "CurveFactory::create_random_circle"), 1);
+    EXPECT_EQ(count_events(events, "CurveFactory::try_create_circle"), 1);
+    EXPECT_EQ(count_events(events, "Executor::parallel_for"), 1);
+    EXPECT_EQ(count_events(events, "Executor::worker"), 4);
+
+    // Every worker records on its own thread
+    std::vector<std::uint32_t> threads;
+    for (const auto& event : events) {
+        if (std::string_view{event.name} == "Executor::worker") {
+            threads.push_back(event.thread_id);
+        }
+    }
+    std::sort(threads.begin(), threads.end());
+    EXPECT_EQ(std::unique(threads.begin(), threads.end()), threads.end());
+}
+
+TEST_F(Trace_test, ring_buffer) {
+    Tracer::get().set_capacity(8);
+    Tracer::get().enable();
+    for (std::size_t i{}; i < 20; ++i) {
+        TraceSpan span{"span"};
+    }
+    Tracer::get().disable();
+
+    // The oldest are overwritten, the rest stay in order
+    const auto events{Tracer::get().get_events()};
+    ASSERT_EQ(events.size(), 8);
+    EXPECT_EQ(Tracer::get().get_dropped_count(), 12);
+    EXPECT_TRUE(std::is_sorted(events.begin(), events.end(), [](const TraceEvent& first, const TraceEvent& second) {
+        return first.start < second.start;
+    }));
+
+    Tracer::get().clear();
+    EXPECT_TRUE(Tracer::get().get_events().empty());
+    EXPECT_EQ(Tracer::get().get_dropped_count(), 0);
+}
+
+TEST_F(Trace_test, chrome_trace) {
+    Tracer::get().enable();
+    {
+        TraceSpan span{"quoted \"name\""};
+    }
+    Tracer::get().disable();
+
+    const auto events{Tracer::get().get_events()};
+    ASSERT_EQ(events.size(), 1);
+    std::ostringstream stream;
+    Tracer::get().write_chrome_trace(stream);
+    const auto json{stream.str()};
+
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(json.find("\"name\":\"quoted \\\"name\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"tid\":" + std::to_string(events[0].thread_id)), std::string::npos);
+    const auto start{std::to_string(events[0].start / 1000) + "."};
+    EXPECT_NE(json.find("\"ts\":" + start), std::string::npos);
+    EXPECT_NE(json.find("],\"displayTimeUnit\":\"ns\"}"), std::string::npos);
+}
+
+} // namespace parallel
+} // namespace curves
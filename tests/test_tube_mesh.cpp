@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/LinearAlgebra.h"
+#include "curves/model3d/Circle.h"
+#include "curves/model3d/CurveFactory.h"
+#include "curves/model3d/Helix.h"
+#include "curves/model3d/TubeMesh.h"
+#include "curves/parallel/Executor.h"
+
+namespace curves {
+namespace model3d {
+
+namespace {
+
+struct Mesh {
+    std::vector<Point3d> positions;
+    std::vector<Vector3d> normals;
+    std::vector<std::uint32_t> indices;
+};
+
+Mesh write(std::span<const std::shared_ptr<Curve>> curves,
+    const TubeParameters& parameters,
+    const TubeMeshLayout& layout,
+    parallel::Executor* executor = nullptr) {
+    Mesh mesh{std::vector<Point3d>(layout.get_vertex_count()),
+        std::vector<Vector3d>(layout.get_vertex_count()),
+        std::vector<std::uint32_t>(layout.get_index_count())};
+    EXPECT_TRUE(write_tube_meshes(curves, parameters, layout, {mesh.positions, mesh.normals, mesh.indices}, executor));
+    return mesh;
+}
+
+// Every triangle faces the way of the vertex normals
+void expect_outward(const Mesh& mesh) {
+    for (std::size_t i{}; i < mesh.indices.size(); i += 3) {
+        const auto& a{mesh.positions[mesh.indices[i]]};
+        const auto& b{mesh.positions[mesh.indices[i + 1]]};
+        const auto& c{mesh.positions[mesh.indices[i + 2]]};
+        const auto face{math::cross_product(b - a, c - a)};
+        const auto normal{mesh.normals[mesh.indices[i]] + mesh.normals[mesh.indices[i + 1]]
+            + mesh.normals[mesh.indices[i + 2]]};
+        ASSERT_GT(math::scalar_product(face, normal), 0.0) << i;
+    }
+}
+
+} // namespace
+
+TEST(TubeMesh_test, size) {
+    const auto circle{CurveFactory::create_circle(Point3d{0.0, 0.0, 0.0}, 10.0, Vector3d{0.0, 0.0, 1.0})};
+
+    // r * (1 - cos(pi / n)) <= tolerance / 2 and (R + r) * dt^2 / 8 <= tolerance / 2
+    const auto size{get_tube_mesh_size(*circle, TubeParameters{1.0, 0.02})};
+    EXPECT_EQ(size.sides, 23);
+    EXPECT_EQ(size.rings, static_cast<std::uint32_t>(std::ceil(math::two_pi / std::sqrt(0.08 / 11.0))) + 1);
+    EXPECT_EQ(size.get_vertex_count(), std::size_t{size.rings} * 23);
+    EXPECT_EQ(size.get_index_count(), 6 * std::size_t{size.rings - 1} * 23);
+
+    EXPECT_EQ(get_tube_mesh_size(*circle, TubeParameters{1.0, 4.0}).sides, 3);
+    EXPECT_EQ(get_tube_mesh_size(*circle, TubeParameters{1.0, 0.0}).get_vertex_count(), 0);
+    EXPECT_EQ(get_tube_mesh_size(*circle, TubeParameters{1.0, 1e-12}).sides, max_tube_sides);
+}
+
+TEST(TubeMesh_test, circle) {
+    const double radius{10.0};
+    const TubeParameters parameters{0.5, 1e-3};
+    const std::vector<std::shared_ptr<Curve>> curves{
+        CurveFactory::create_circle(Point3d{1.0, 2.0, 3.0}, radius, Vector3d{0.0, 0.0, 1.0})};
+    const auto layout{get_tube_mesh_layout(curves, parameters)};
+    const auto mesh{write(curves, parameters, layout)};
+
+    // Vertices on the tube, normals pointing away from the center line
+    for (std::size_t i{}; i < mesh.positions.size(); ++i) {
+        const auto offset{mesh.positions[i] - Point3d{1.0, 2.0, 3.0}};
+        const double planar{std::hypot(offset.x(), offset.y())};
+        EXPECT_NEAR(std::hypot(planar - radius, offset.z()), 0.5, 1e-9);
+        EXPECT_NEAR(mesh.normals[i].get_magnitude(), 1.0, 1e-12);
+        const auto center{math::translate(mesh.positions[i], mesh.normals[i] * -0.5)};
+        EXPECT_NEAR(std::hypot(center.x() - 1.0, center.y() - 2.0), radius, 1e-9);
+    }
+    expect_outward(mesh);
+
+    // Triangle centers stay within the tolerance of the tube
+    for (std::size_t i{}; i < mesh.indices.size(); i += 3) {
+        std::array<double, 3> centroid{};
+        for (std::size_t k{}; k < 3; ++k) {
+            for (std::size_t axis{}; axis < 3; ++axis) {
+                centroid[axis] += mesh.positions[mesh.indices[i + k]].data()[axis] / 3.0;
+            }
+        }
+        const double planar{std::hypot(centroid[0] - 1.0, centroid[1] - 2.0)};
+        EXPECT_LE(std::abs(std::hypot(planar - radius, centroid[2] - 3.0) - 0.5), parameters.tolerance);
+    }
+}
+
+TEST(TubeMesh_test, helix_frame) {
+    const std::vector<std::shared_ptr<Curve>> curves{CurveFactory::create_helix(
+        Point3d{0.0, 0.0, 0.0}, 2.0, 3.0, Vector3d{0.0, 0.0, 1.0}, Vector3d{1.0, 0.0, 0.0})};
+    const TubeParameters parameters{0.25, 1e-3, -1.0, 10.0};
+    const auto layout{get_tube_mesh_layout(curves, parameters)};
+    const auto mesh{write(curves, parameters, layout)};
+    const auto size{layout.sizes[0]};
+
+    // Profiles lie in the normal plane of the helix around the curve point
+    const double dt{11.0 / static_cast<double>(size.rings - 1)};
+    for (std::uint32_t ring{}; ring < size.rings; ++ring) {
+        const double t{-1.0 + ring * dt};
+        const auto point{curves[0]->get_point(t)};
+        const auto tangent{curves[0]->get_first_derivative(t)};
+        for (std::uint32_t side{}; side < size.sides; ++side) {
+            const std::size_t vertex{std::size_t{ring} * size.sides + side};
+            EXPECT_NEAR(math::scalar_product(mesh.normals[vertex], tangent), 0.0, 1e-9);
+            EXPECT_TRUE(
+                math::equal(math::translate(point, mesh.normals[vertex] * 0.25), mesh.positions[vertex], 1e-9));
+        }
+    }
+    expect_outward(mesh);
+}
+
+TEST(TubeMesh_test, batch) {
+    std::vector<std::shared_ptr<Curve>> curves;
+    for (std::size_t i{}; i < 100; ++i) {
+        curves.push_back(CurveFactory::create_random_curve());
+    }
+    const TubeParameters parameters{100.0, 50.0};
+    const auto layout{get_tube_mesh_layout(curves, parameters)};
+    ASSERT_EQ(layout.vertex_offsets.size(), curves.size() + 1);
+
+    const auto serial{write(curves, parameters, layout)};
+    parallel::Executor executor{4};
+    const auto mesh{write(curves, parameters, layout, &executor)};
+    EXPECT_EQ(mesh.indices, serial.indices);
+    for (std::size_t i{}; i < mesh.positions.size(); ++i) {
+        ASSERT_EQ(mesh.positions[i].data(), serial.positions[i].data());
+    }
+
+    // Indices stay within the mesh of their curve
+    for (std::size_t curve{}; curve < curves.size(); ++curve) {
+        for (auto i{layout.index_offsets[curve]}; i < layout.index_offsets[curve + 1]; ++i) {
+            ASSERT_GE(mesh.indices[i], layout.vertex_offsets[curve]);
+            ASSERT_LT(mesh.indices[i], layout.vertex_offsets[curve + 1]);
+        }
+    }
+
+    // Buffers too short
+    std::vector<Point3d> positions(layout.get_vertex_count() - 1);
+    std::vector<Vector3d> normals(layout.get_vertex_count());
+    std::vector<std::uint32_t> indices(layout.get_index_count());
+    EXPECT_FALSE(write_tube_meshes(curves, parameters, layout, {positions, normals, indices}));
+}
+
+} // namespace model3d
+} // namespace curves
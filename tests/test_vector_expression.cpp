@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include "curves/math/LinearAlgebra.h"
+#include "curves/math/Point.h"
+#include "curves/math/Vector.h"
+#include "curves/math/VectorExpression.h"
+
+namespace curves {
+namespace math {
+
+using Point3d = Point<double, 3>;
+using Vector3d = Vector<double, 3>;
+
+TEST(VectorExpression_test, padded_storage) {
+    static_assert(sizeof(Vector3d) == 32);
+    static_assert(alignof(Vector3d) == 32);
+    static_assert(sizeof(Point3d) == 32);
+    static_assert(sizeof(Vector<float, 3>) == 3 * sizeof(float));
+    static_assert(sizeof(Vector<double, 2>) == 2 * sizeof(double));
+
+    const std::vector<Point3d> points(5, Point3d{1.0, 2.0, 3.0});
+    for (const auto& point : points) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&point) % 32, 0);
+    }
+    EXPECT_EQ(points[4].data(), (std::array<double, 3>{1.0, 2.0, 3.0}));
+}
+
+TEST(VectorExpression_test, matches_eager_operators) {
+    const Vector3d u{0.6, -0.8, 0.0};
+    const Vector3d v{0.0, 0.0, 1.0};
+    const Point3d center{1.5, -2.25, 1e6};
+    const double cos{std::cos(0.7)};
+    const double sin{std::sin(0.7)};
+    const double radius{3.1};
+
+    const Point3d eager{translate(center, (u * cos + v * sin) * radius)};
+    const Point3d fused{lazy(center) + (lazy(u) * cos + lazy(v) * sin) * radius};
+    EXPECT_EQ(fused.data(), eager.data());
+
+    const Vector3d difference{lazy(u) - lazy(v) / 2.0};
+    EXPECT_EQ(difference.data(), (u - v / 2.0).data());
+
+    const auto evaluated{evaluate<Vector3d>(lazy(u) * 2.0)};
+    EXPECT_EQ(evaluated.data(), (u * 2.0).data());
+}
+
+} // namespace math
+} // namespace curves